@@ -7,12 +7,18 @@
 * @date 2018-5-19
 */
 #include "biopsy_inference.h"
-#include "face_feature_train_mean.h"
-#include "face_feature_train_std.h"
+#include "nv12_converter.h"
+#include "landmark_decoder.h"
+#include "normalization_sidecar.h"
 #include "hiaiengine/log.h"
 #include "hiaiengine/data_type_reg.h"
 #include "ascenddk/ascend_ezdvpp/dvpp_process.h"
 #include <memory>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
 #include <fstream>
 #include <sstream>
 #include <stdio.h>
@@ -26,19 +32,24 @@ using namespace cv;
 
 namespace {
 // The image's width need to be resized
-const int32_t kResizedImgWidth = 224;
+const int32_t kResizedImgWidth = RESIZE_WIDTH;
 
 // The image's height need to be resized
-const int32_t kResizedImgHeight = 224;
+const int32_t kResizedImgHeight = RESIZE_HEIGHT;
 
-const int32_t kEachResult1Size = 68;//特征点结果数
-const int32_t kEachResult2Size = 3;//姿态结果数
+const int32_t kEachResult1Size = kFaceLandmarkNum;//特征点结果数
+const int32_t kEachResult2Size = kHeadPoseNum;//姿态结果数
+// floats of one face in output 0, x and y of every point
+const int32_t kEachResult1Floats = kEachResult1Size * 2;
 // inference output result index
 const int32_t kResult1Index = 0;
 const int32_t kResult2Index = 1;
 
 // The rgb image's channel number
-const int32_t kRgbChannel = 3;
+const int32_t kRgbChannel = RGB_CHANNEL;
+
+// head pose output is normalized by this value
+const float kHeadPoseScale = 50;
 
 // For each input, the result should be one tensor
 const int32_t kEachResultTensorNum = 10;
@@ -47,8 +58,94 @@ const int32_t kEachResultTensorNum = 10;
 const float kNormalizedCenterData = 0.5;
 
 const int32_t kSendDataIntervalMiss = 20;
+
+// pyramid level index of the original image
+const int32_t kOriginalImageLevel = -1;
+
+// face size of the warm-up frame, a little larger than the model input
+const int32_t kWarmUpFaceSize = 256;
+
+// normalize parameter key in graph.config, 1: sub mean and divide std
+const string kNormalizeParamKey = "normalize";
+
+// model input parameter key in graph.config, 1: NV12 to the AIPP model,
+// 0: BGR float converted by CPU
+const string kAippInputParamKey = "aipp_input";
+
+// normalization sidecar parameter key in graph.config, empty means the
+// .norm file next to the model
+const string kNormalizationPathParamKey = "normalization_path";
+
+// most difference of the fused converter from opencv in pixel levels
+// before normalization, both round the same fixed point coefficients
+const float kConverterMaxDiff = 1.0f;
+
+// log the throughput every N frames with face
+const uint64_t kThroughputLogInterval = 100;
+
+// landmark reuse parameter keys in graph.config
+const string kRefreshIntervalParamKey = "landmark_refresh_interval";
+const string kReuseIouParamKey = "landmark_reuse_iou";
+const string kReusePixelDiffParamKey = "landmark_reuse_pixel_diff";
+
+// rows and columns of the luma grid sampled in a face
+const int32_t kSignatureGridSize = 8;
+
+// age of a face result which is just inferred
+const int32_t kInferredAge = -1;
+
+// log the landmark reuse counters every N frames with face
+const uint64_t kReuseLogInterval = 100;
+
+/**
+* @brief: intersection over union of two face boxes
+*/
+float FaceIou(const FaceRectangle &a, const FaceRectangle &b) {
+  int32_t width = min(a.rb.x, b.rb.x) - max(a.lt.x, b.lt.x);
+  int32_t height = min(a.rb.y, b.rb.y) - max(a.lt.y, b.lt.y);
+  if (width <= 0 || height <= 0) {
+    return 0;
+  }
+  float inter = static_cast<float>(width) * height;
+  float area_a = static_cast<float>(a.rb.x - a.lt.x) * (a.rb.y - a.lt.y);
+  float area_b = static_cast<float>(b.rb.x - b.lt.x) * (b.rb.y - b.lt.y);
+  return inter / (area_a + area_b - inter);
+}
+
+/**
+* @brief: average absolute difference of two luma signatures
+*/
+float SignatureDiff(const vector<u_int8_t> &a, const vector<u_int8_t> &b) {
+  if (a.empty() || a.size() != b.size()) {
+    return numeric_limits<float>::max();
+  }
+  int32_t sum = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    sum += abs(static_cast<int32_t>(a[i]) - static_cast<int32_t>(b[i]));
+  }
+  return static_cast<float>(sum) / a.size();
+}
+
+/**
+* @brief: move the landmarks of a track to the new face box, the face is
+*   stationary so the shift and scale of the box is tiny
+*/
+void MoveLandmarks(const FaceRectangle &from, const FaceRectangle &to,
+                   const InferenceResult &result, InferenceResult &moved) {
+  float scale_x = (from.rb.x > from.lt.x) ?
+      static_cast<float>(to.rb.x - to.lt.x) / (from.rb.x - from.lt.x) : 1;
+  float scale_y = (from.rb.y > from.lt.y) ?
+      static_cast<float>(to.rb.y - to.lt.y) / (from.rb.y - from.lt.y) : 1;
+  float from_x = 0.5 * (from.lt.x + from.rb.x);
+  float from_y = 0.5 * (from.lt.y + from.rb.y);
+  float to_x = 0.5 * (to.lt.x + to.rb.x);
+  float to_y = 0.5 * (to.lt.y + to.rb.y);
+  moved = result;
+  MapLandmarks(result.x, result.y, kEachResult1Size, scale_x,
+               to_x - from_x * scale_x, scale_y, to_y - from_y * scale_y,
+               moved.x, moved.y);
+}
 }
-shared_ptr<FaceRecognitionInfo> face_recognition_info2;
 
 /**
 * @ingroup hiaiengine
@@ -58,181 +155,202 @@ shared_ptr<FaceRecognitionInfo> face_recognition_info2;
 HIAI_StatusT biopsy_inference::Init(const hiai::AIConfig &config,
     const std::vector<hiai::AIModelDescription> &model_desc)
 {
-    if (!InitAiModel(config)) {
-        return HIAI_ERROR;
+    StartupTimer startup_timer("biopsy_inference");
+    string model_path;
+    string normalization_path;
+    for (int index = 0; index < config.items_size(); ++index) {
+        const AIConfigItem &item = config.items(index);
+        if (item.name() == kModelPathParamKey) {
+            model_path = item.value();
+        } else if (item.name() == kNormalizationPathParamKey) {
+            normalization_path = item.value();
+        } else if (item.name() == kNormalizeParamKey) {
+            stringstream ss(item.value());
+            ss >> normalize_;
+        } else if (item.name() == kAippInputParamKey) {
+            stringstream ss(item.value());
+            ss >> aipp_input_;
+        } else if (item.name() == kRefreshIntervalParamKey) {
+            stringstream ss(item.value());
+            ss >> refresh_interval_;
+        } else if (item.name() == kReuseIouParamKey) {
+            stringstream ss(item.value());
+            ss >> reuse_iou_;
+        } else if (item.name() == kReusePixelDiffParamKey) {
+            stringstream ss(item.value());
+            ss >> reuse_pixel_diff_;
+        } else if (item.name() == kDeviceJpegQualityParamKey) {
+            if (!ParseDeviceJpegQuality(item.value(), device_jpeg_quality_)) {
+                HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                                "device_jpeg_quality=%s which configured is "
+                                "invalid.", item.value().c_str());
+                return HIAI_ERROR;
+            }
+        }
     }
 
-    if (!InitNormlizedData()) {
+    // initialize model, model path and batch size are parsed by the stage,
+    // the input size of the model must match the configured input
+    uint32_t item_size = aipp_input_ ? BiopsyPreProcessor::kAippItemSize
+        : BiopsyPreProcessor::kItemSize;
+    if (!stage_.Init(config, item_size)) {
         return HIAI_ERROR;
     }
-    return HIAI_OK;
-}
-bool biopsy_inference::InitAiModel(const AIConfig &config) {
-    AIStatus ret = SUCCESS;
-
-    // Define the initialization value for the ai_model_manager_
-    if (ai_model_manager_ == nullptr) {
-        ai_model_manager_ = make_shared<AIModelManager>();
+    startup_timer.Phase("model load");
+    if (aipp_input_ && normalize_) {
+        HIAI_ENGINE_LOG("aipp_input is set, normalize is done by the AIPP "
+                        "configuration of the model");
     }
 
-    vector<AIModelDescription> model_desc_vec;
-    AIModelDescription model_desc;
-
-    // Get the model information from the file graph.config
-    for (int index = 0; index < config.items_size(); ++index) {
-        const AIConfigItem &item = config.items(index);
-        if (item.name() == kModelPathParamKey) {
-        const char *model_path = item.value().data();
-        model_desc.set_path(model_path);
-        } else if (item.name() == kBatchSizeParamKey) {
-        stringstream ss(item.value());
-        ss >> batch_size_;
-        } else {
-        continue;
+    // AIPP normalizes by its own configuration
+    if (normalize_ && !aipp_input_) {
+        if (normalization_path.empty()) {
+            normalization_path = NormalizationSidecar::PathOfModel(model_path);
         }
+        if (!InitNormlizedData(normalization_path)) {
+            return HIAI_ERROR;
+        }
+        startup_timer.Phase("normalization load");
     }
 
-    //Invoke the framework's interface to init the information
-    model_desc_vec.push_back(model_desc);
-    ret = ai_model_manager_->Init(config, model_desc_vec);
+    // pay the lazy initialization of model and dvpp before the first frame
+    if (!WarmUp()) {
+        return HIAI_ERROR;
+    }
+    startup_timer.Phase("warm-up");
+    HIAI_ENGINE_LOG("landmark reuse: refresh interval=%d, iou=%f, "
+                    "pixel diff=%f", refresh_interval_, reuse_iou_,
+                    reuse_pixel_diff_);
 
-    if (ret != SUCCESS) {
-        HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                        "AI model init failed!");
-        return false;
+    // the CPU converter is the reference of AIPP, only check it when used
+    if (!aipp_input_ && !CheckConverter()) {
+        return HIAI_ERROR;
     }
-    return true;
+    startup_timer.Finish();
+    return HIAI_OK;
 }
 
-bool biopsy_inference::InitNormlizedData() {
-    // Load the mean data
-    Mat train_mean_value(kResizedImgWidth, kResizedImgHeight, CV_32FC3, (void *)kTrainMean);
-    train_mean_ = train_mean_value;
-    if (train_mean_.empty()) {
+bool biopsy_inference::InitNormlizedData(const string &path) {
+    // mapped read-only, the shape must be the model input
+    normalization_ = NormalizationSidecar::Load(path, kResizedImgHeight,
+                                                kResizedImgWidth, kRgbChannel);
+    if (normalization_ == nullptr) {
         HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                        "Load mean failed!");
+                        "Load mean and std failed!");
         return false;
     }
 
-    // Load the STD data
-    Mat train_std_value(kResizedImgWidth, kResizedImgHeight, CV_32FC3, (void *)kTrainStd);
-    train_std_ = train_std_value;
-    if (train_std_.empty()) {
-        HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                        "Load std failed!");
-        return false;
-    }
+    // the Mats only refer to the mapping, they are never written
+    train_mean_ = Mat(kResizedImgHeight, kResizedImgWidth, CV_32FC3,
+                      const_cast<float *>(normalization_->mean()));
+    train_std_ = Mat(kResizedImgHeight, kResizedImgWidth, CV_32FC3,
+                     const_cast<float *>(normalization_->std_dev()));
     HIAI_ENGINE_LOG("Load mean and std success!");
     return true;
 }
 
-bool biopsy_inference::Crop(const shared_ptr<FaceRecognitionInfo> &face_recognition_info, const ImageData<u_int8_t> &org_img,
-                                  vector<FaceImage> &face_imgs) {
-  HIAI_ENGINE_LOG("Begin to crop the face, face number is %d",
-                  face_imgs.size());
-  int32_t img_size = org_img.size;
-  for (vector<FaceImage>::iterator face_img_iter = face_imgs.begin();
-       face_img_iter != face_imgs.end(); ++face_img_iter) {
-    // call ez_dvpp to crop image
-    DvppBasicVpcPara crop_para;
-    crop_para.input_image_type = face_recognition_info->frame.org_img_format;
-
-    // Change the left top coordinate to even numver 将左上角坐标改变为偶数
-    u_int32_t lt_horz = ((face_img_iter->rectangle.lt.x) >> 1) << 1;
-    u_int32_t lt_vert = ((face_img_iter->rectangle.lt.y) >> 1) << 1;
-    // Change the left top coordinate to odd numver 将右下角坐标改变为奇数
-    u_int32_t rb_horz = (((face_img_iter->rectangle.rb.x) >> 1) << 1) - 1;
-    u_int32_t rb_vert = (((face_img_iter->rectangle.rb.y) >> 1) << 1) - 1;
-    HIAI_ENGINE_LOG("The crop is from left-top(%d,%d) to right-bottom(%d,%d)",
-                    lt_horz, lt_vert, rb_horz, rb_vert);
-    // 偶数减去奇数再加1，还是偶数
-    u_int32_t cropped_width = rb_horz - lt_horz + 1;
-    u_int32_t cropped_height = rb_vert - lt_vert + 1;
-
-    crop_para.src_resolution.width = org_img.width;
-    crop_para.src_resolution.height = org_img.height;
-    crop_para.dest_resolution.width = cropped_width;
-    crop_para.dest_resolution.height = cropped_height;
-    crop_para.crop_left = lt_horz;
-    crop_para.crop_right = rb_horz;
-    crop_para.crop_up = lt_vert;
-    crop_para.crop_down = rb_vert;
-
-    // The align flag for input and output data,output data should be aligned 对齐标志。裁剪后输出的数据需要是对齐的
-    crop_para.is_input_align = face_recognition_info->frame.img_aligned;
-    crop_para.is_output_align = false;
-    DvppProcess dvpp_crop_img(crop_para);
-    DvppVpcOutput dvpp_output;
-    int ret = dvpp_crop_img.DvppBasicVpcProc(
-                org_img.data.get(), img_size, &dvpp_output);
-    if (ret != kDvppOperationOk) {
-      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                      "Call ez_dvpp failed, failed to crop image.");
-      return false;
+int32_t biopsy_inference::SelectPyramidLevel(
+    const shared_ptr<FaceRecognitionInfo> &face_recognition_info,
+    const FaceRectangle &rectangle) {
+  const vector<ImageData<u_int8_t>> &pyramid = face_recognition_info->pyramid;
+  uint32_t org_width = face_recognition_info->org_img.width;
+  int32_t face_width = rectangle.rb.x - rectangle.lt.x;
+  int32_t face_height = rectangle.rb.y - rectangle.lt.y;
+
+  // levels are ordered from large to small, stop at the first level which
+  // can not provide the model input resolution any more
+  int32_t level = kOriginalImageLevel;
+  for (size_t i = 0; i < pyramid.size() && org_width > 0; ++i) {
+    float scale = static_cast<float>(pyramid[i].width) / org_width;
+    if ((face_width * scale < kResizedImgWidth)
+        || (face_height * scale < kResizedImgHeight)) {
+      break;
     }
-
-    // 最终给faceimgs结构填充图像内容
-    face_img_iter->image.data.reset(dvpp_output.buffer, default_delete<u_int8_t[]>());
-    face_img_iter->image.size = dvpp_output.size;
-    face_img_iter->image.width = cropped_width;
-    face_img_iter->image.height = cropped_height;
-    //std::cout<<"size:"<<face_img_iter->image.size<<" width"<<face_img_iter->image.width<<" height"<<face_img_iter->image.height<<std::endl;
+    level = i;
   }
-  return true;
+  return level;
 }
 
-bool biopsy_inference::Resize(const vector<FaceImage> &face_imgs,
-                                    vector<ImageData<u_int8_t>> &resized_imgs) {
-  // Begin to resize all the resize image
-  for (vector<FaceImage>::const_iterator face_img_iter = face_imgs.begin();
-       face_img_iter != face_imgs.end(); ++face_img_iter) {
-
-    int32_t img_size = face_img_iter->image.size;
-    if (img_size <= 0) {
+bool biopsy_inference::CropResize(
+  const shared_ptr<FaceRecognitionInfo> &face_recognition_info,
+  const vector<int32_t> &face_indexes,
+  vector<ImageData<u_int8_t>> &resized_imgs) {
+  const ImageData<u_int8_t> &org_img = face_recognition_info->org_img;
+  const vector<FaceImage> &face_imgs = face_recognition_info->face_imgs;
+  HIAI_ENGINE_LOG("Begin to crop and resize the face, face number is %d",
+                  face_indexes.size());
+  // every face is cropped by its own vpc call on the worker pool, the
+  // result is kept in the order of face_indexes
+  resized_imgs.resize(face_indexes.size());
+  return WorkerPool::Instance().ParallelFor(
+      face_indexes.size(), [&](int32_t index) {
+    vector<FaceImage>::const_iterator face_img_iter =
+        face_imgs.begin() + face_indexes[index];
+    // crop from the smallest image which still has enough resolution
+    int32_t level = SelectPyramidLevel(face_recognition_info,
+                                       face_img_iter->rectangle);
+    const ImageData<u_int8_t> &src_img = (level == kOriginalImageLevel) ?
+        org_img : face_recognition_info->pyramid[level];
+    float scale = static_cast<float>(src_img.width) / org_img.width;
+
+    // face position in the source image, aligned for vpc
+    DetectionRoi crop_area;
+    crop_area.left = max(0, static_cast<int32_t>(
+        face_img_iter->rectangle.lt.x * scale));
+    crop_area.up = max(0, static_cast<int32_t>(
+        face_img_iter->rectangle.lt.y * scale));
+    crop_area.right = max(0, static_cast<int32_t>(
+        face_img_iter->rectangle.rb.x * scale));
+    crop_area.down = max(0, static_cast<int32_t>(
+        face_img_iter->rectangle.rb.y * scale));
+    if (!AlignCropArea(src_img.width, src_img.height, crop_area)) {
       HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                      "image size less than or equal zero, size=%d", img_size);
+                      "face (%d,%d)-(%d,%d) is out of image.",
+                      face_img_iter->rectangle.lt.x,
+                      face_img_iter->rectangle.lt.y,
+                      face_img_iter->rectangle.rb.x,
+                      face_img_iter->rectangle.rb.y);
       return false;
     }
+    HIAI_ENGINE_LOG("The crop is from left-top(%d,%d) to right-bottom(%d,%d)",
+                    crop_area.left, crop_area.up, crop_area.right,
+                    crop_area.down);
 
-    // 人脸图像的真实宽、高
-    int32_t origin_width = face_img_iter->image.width;
-    int32_t origin_height = face_img_iter->image.height;
-    ImageData<u_int8_t> resized_image;
-    DvppBasicVpcPara resize_para;
-
-    resize_para.input_image_type = face_recognition_info2->frame.org_img_format;//INPUT_YUV420_SEMI_PLANNER_UV;
-    resize_para.crop_left = 0;
-    resize_para.crop_up = 0;
-    resize_para.crop_right = origin_width - 1;
-    resize_para.crop_down = origin_height - 1;
-    resize_para.src_resolution.width = origin_width;
-    resize_para.src_resolution.height = origin_height;
-
-    resize_para.dest_resolution.width = kResizedImgWidth;
-    resize_para.dest_resolution.height = kResizedImgHeight;
-    //resize_para.is_input_align = true;
-    resize_para.is_output_align = false;
-    resize_para.is_input_align = face_recognition_info2->frame.img_aligned;
-    DvppProcess dvpp_resize_img(resize_para);
-
-    // Invoke EZ_DVPP interface to resize image
+    // call ez_dvpp to crop the face and resize it to model input in one vpc
+    DvppBasicVpcPara crop_para;
+    crop_para.input_image_type = face_recognition_info->frame.org_img_format;
+    crop_para.src_resolution.width = src_img.width;
+    crop_para.src_resolution.height = src_img.height;
+    crop_para.crop_left = crop_area.left;
+    crop_para.crop_right = crop_area.right;
+    crop_para.crop_up = crop_area.up;
+    crop_para.crop_down = crop_area.down;
+    crop_para.dest_resolution.width = kResizedImgWidth;
+    crop_para.dest_resolution.height = kResizedImgHeight;
+
+    // pyramid levels are not aligned, the model input is not aligned
+    crop_para.is_input_align = (level == kOriginalImageLevel) ?
+        face_recognition_info->frame.img_aligned : false;
+    crop_para.is_output_align = false;
+    DvppProcess dvpp_crop_img(crop_para);
     DvppVpcOutput dvpp_output;
-    int ret = dvpp_resize_img.DvppBasicVpcProc(
-                face_img_iter->image.data.get(), img_size, &dvpp_output);
+    int ret = dvpp_crop_img.DvppBasicVpcProc(
+                src_img.data.get(), src_img.size, &dvpp_output);
     if (ret != kDvppOperationOk) {
       HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                      "Call ez_dvpp failed, failed to resize image.");
+                      "Call ez_dvpp failed, failed to crop and resize image.");
       return false;
     }
 
     // call success, set data and size
+    ImageData<u_int8_t> resized_image;
     resized_image.data.reset(dvpp_output.buffer, default_delete<u_int8_t[]>());
     resized_image.size = dvpp_output.size;
     resized_image.width = kResizedImgWidth;
     resized_image.height = kResizedImgHeight;
-    resized_imgs.push_back(resized_image);
-  }
-  return true;
+    resized_imgs[index] = resized_image;
+    return true;
+  });
 }
 
 bool biopsy_inference::ImageYUV2BGR (
@@ -403,127 +521,81 @@ bool biopsy_inference::NormalizeData (
 //     return true;
 // }
 
-//-- region  BGRInfarence
-bool biopsy_inference::Inference(vector<Mat> &normalized_image,
-                                       vector<FaceImage> &face_imgs) {
-  // Define the ai model's data
-  AIContext ai_context;
-
-  int normalized_image_size = normalized_image.size();
-  int normalized_image_mod = normalized_image_size % batch_size_;
-
-  // calcuate the iter number
-  // calcuate the value by batch
-  int iter_num = normalized_image_mod == 0 ?
-                 (normalized_image_size / batch_size_) : (normalized_image_size / batch_size_ + 1);
-
-  // Invoke interface to do the inference
-  for (int i = 0; i < iter_num; i++) {
-    HIAI_ENGINE_LOG("Batch data's number is %d!", i);
-    int start_index = batch_size_ * i;
-    int end_index = start_index + batch_size_;
-
-    // Last group data, need to fulfill the extra data
-    // fulfill with last Mat in the vector
-    if (i == iter_num - 1 && normalized_image_mod != 0) {
-      int fulfill_number = batch_size_ - normalized_image_mod;
-      EnrichDataByLastMat(normalized_image, fulfill_number);
-      end_index = i * batch_size_ + normalized_image_mod;
-    }
-
-    float *tensor_buffer = new(std::nothrow) float[batch_size_ * kResizedImgWidth * kResizedImgHeight * kRgbChannel];
-    if (tensor_buffer == nullptr) {
-      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                      "New the tensor buffer error.");
-      return false;
-    }
-    int last_size = CopyDataToBuffer(normalized_image, start_index, tensor_buffer);
-
-    if (last_size == -1) {
-      return false;
-    }
-
-    vector<shared_ptr<IAITensor>> input_data_vec;
-    shared_ptr<AINeuralNetworkBuffer> neural_buffer = shared_ptr <
-        AINeuralNetworkBuffer > (new(std::nothrow) AINeuralNetworkBuffer());
-    shared_ptr<IAITensor> input_data = static_pointer_cast <
-                                       IAITensor > (neural_buffer);
-    neural_buffer->SetBuffer((void *)tensor_buffer,  last_size * sizeof(float));
-    input_data_vec.push_back(input_data);
-
-    vector<shared_ptr<IAITensor>> output_data_vec;
-    AIStatus ret = ai_model_manager_->CreateOutputTensor(input_data_vec, output_data_vec);
-    if (ret != SUCCESS) {
-      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                      "Fail to create output tensor");
-      delete [] tensor_buffer;
-      return false;
-    }
-
-    ret = ai_model_manager_->Process(ai_context, input_data_vec, output_data_vec, 0);
+bool biopsy_inference::BiopsyPreProcessor::PreProcess(
+  BiopsyContext &context, int32_t index, uint8_t *slot) {
+  const ImageData<u_int8_t> &resized_img = (*context.resized_imgs)[index];
+  int32_t nv12_size = kResizedImgWidth * kResizedImgHeight * kNv12SizeMolecule
+      / kNv12SizeDenominator;
+  if (resized_img.size < nv12_size) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "resized image size is not correct, size=%u",
+                    resized_img.size);
+    return false;
+  }
 
-    if (ret != SUCCESS) {
+  // AIPP of the model converts on device, the VPC output is the input
+  if (context.aipp_input) {
+    errno_t mem_ret = memcpy_s(slot, kAippItemSize, resized_img.data.get(),
+                               nv12_size);
+    if (mem_ret != EOK) {
       HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                      "Fail to process the data in FWK");
-      delete [] tensor_buffer;
+                      "copy the NV12 face error, ret=%d", mem_ret);
       return false;
     }
-    std::cout<<"output data vec size:"<<output_data_vec.size();
-
-    HIAI_ENGINE_LOG("Inference successed!");
+    return true;
+  }
 
-    // Get the inference result.
-    shared_ptr<AISimpleTensor> result_tensor = static_pointer_cast <
-        AISimpleTensor > (output_data_vec[kResult1Index]);//第0路输出 136个float
-    shared_ptr<hiai::AISimpleTensor> result_tensor1 = static_pointer_cast <
-        AISimpleTensor > (output_data_vec[kResult2Index]);//第1路输出 3个float
+  // convert to BGR, normalize and split to planes straight into the slot
+  Nv12ToPlanarBgr(resized_img.data.get(), kResizedImgWidth, kResizedImgHeight,
+                  kResizedImgWidth, context.mean, context.std_dev,
+                  reinterpret_cast<float *>(slot));
+  return true;
+}
 
-    // copy data to float array
-    int32_t size = result_tensor->GetSize() / sizeof(float);
-    int32_t size1 = result_tensor1->GetSize() / sizeof(float);
-        
-    float result[size];
-    errno_t mem_ret = memcpy_s(result, sizeof(result), result_tensor->GetBuffer(),
-                                result_tensor->GetSize());
-    if (mem_ret != EOK) {
-        HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                        "post process call memcpy_s() error=%d", mem_ret);
-        return false;
-    }
-    int32_t k_points = 0;
-    int x=face_imgs[i].rectangle.lt.x,y=face_imgs[i].rectangle.lt.y,z=face_imgs[i].rectangle.rb.x,w=face_imgs[i].rectangle.rb.y; 
-	while(k_points < kEachResult1Size)
-    {
-      face_imgs[i].infe_res.face_points[k_points].x = result[k_points * 2]*(z - x)*0.5 + 0.5*(x + z);
-      face_imgs[i].infe_res.face_points[k_points].y = result[(k_points * 2) + 1]*(w - y)*0.5 + 0.5*(y + w);
-      k_points += 1;
-    }
+bool biopsy_inference::BiopsyPostProcessor::PostProcess(
+  BiopsyContext &context, int32_t index, int32_t slot,
+  const vector<shared_ptr<IAITensor>> &output_data_vec) {
+  if (output_data_vec.size() <= kResult2Index) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "the output tensor number is not correct, number is %d",
+                    output_data_vec.size());
+    return false;
+  }
 
-    float result1[size1];
-    errno_t mem_ret1 = memcpy_s(result1, sizeof(result1), result_tensor1->GetBuffer(),
-                                result_tensor1->GetSize());
-    if (mem_ret1 != EOK) {
-        HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                        "post process call memcpy_s() error=%d", mem_ret1);
-        return false;
-    }
-    int32_t k_pose = 0;
-    while(k_pose < kEachResult2Size)
-    {
-      face_imgs[i].infe_res.head_pose[k_pose] = result1[k_pose] * 50;
-      k_pose += 1;
-    }
-    // if (!ArrangeFaceMarkInfo(result_tensor, start_index, end_index, face_imgs)) {
-    //   delete [] tensor_buffer;
-    //   return false;
-    // }
-    input_data_vec.clear();
-    output_data_vec.clear();
-    delete [] tensor_buffer;
+  // 第0路输出 每张脸136个float, 第1路输出 每张脸3个float
+  shared_ptr<AISimpleTensor> result_tensor = static_pointer_cast <
+      AISimpleTensor > (output_data_vec[kResult1Index]);
+  shared_ptr<AISimpleTensor> result_tensor1 = static_pointer_cast <
+      AISimpleTensor > (output_data_vec[kResult2Index]);
+  int32_t size = result_tensor->GetSize() / sizeof(float);
+  int32_t size1 = result_tensor1->GetSize() / sizeof(float);
+  if ((size < (slot + 1) * kEachResult1Floats)
+      || (size1 < (slot + 1) * kEachResult2Size)) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "the result tensor's size is not correct, size0 is %d, size1 is %d",
+                    size, size1);
+    return false;
   }
+  const float *result = static_cast<const float *>(result_tensor->GetBuffer())
+      + slot * kEachResult1Floats;
+  const float *result1 = static_cast<const float *>(result_tensor1->GetBuffer())
+      + slot * kEachResult2Size;
+
+  // result of the slot-th face in the batch belongs to the index-th face
+  // which needs inference
+  FaceImage &face_img =
+      (*context.face_imgs)[(*context.face_indexes)[index]];
+  // output is normalized to [-1, 1] of the face box, decoded from the
+  // tensor buffer into the result arrays
+  int x = face_img.rectangle.lt.x, y = face_img.rectangle.lt.y;
+  int z = face_img.rectangle.rb.x, w = face_img.rectangle.rb.y;
+  DecodeLandmarks(result, kEachResult1Size, (z - x) * 0.5f, (x + z) * 0.5f,
+                  (w - y) * 0.5f, (y + w) * 0.5f, face_img.infe_res.x,
+                  face_img.infe_res.y);
+  DecodePose(result1, kEachResult2Size, kHeadPoseScale,
+             face_img.infe_res.head_pose);
   return true;
 }
-//-- end region
 
 bool biopsy_inference::ArrangeFaceMarkInfo(
   const shared_ptr<AISimpleTensor> &result_tensor,
@@ -588,92 +660,346 @@ void biopsy_inference::EnrichFacePosition(int *face_position, FaceFeature *face_
     face_feature->right_mouth.y = face_position[FaceFeaturePos::kRightMouthY];
 }
 
-void biopsy_inference::EnrichDataByLastMat(vector<Mat> &normalized_image,
-    int number) {
-  Mat last_mat = normalized_image[normalized_image.size() - 1];
-  for (int i = 0; i < number; i++) {
-    normalized_image.push_back(last_mat);
+bool biopsy_inference::IsDataHandleWrong(shared_ptr<FaceRecognitionInfo> &face_detail_info) {
+  ErrorInfo err_info = face_detail_info->err_info;
+  if (err_info.err_code != AppErrorCode::kNone) {
+    return false;
   }
+  return true;
 }
 
-int biopsy_inference::CopyDataToBuffer(vector<Mat> &normalized_image,
-    int start_index, float *tensor_buffer) {
+HIAI_StatusT biopsy_inference::SendFailed(const string error_log,
+    shared_ptr<FaceRecognitionInfo> &face_recognition_info) {
 
-  int last_size = 0;
-  for (int i = start_index; i < start_index + batch_size_; i++) {
+  HIAI_ENGINE_LOG("VCNN network run error");
+  ErrorInfo err_info = face_recognition_info->err_info;
+  err_info.err_code = AppErrorCode::kFeatureMask;
+  err_info.err_msg = error_log;
+  EncodeOriginalImage(device_jpeg_quality_, *face_recognition_info);
+  return SendDataWithRetry(this, DEFAULT_DATA_PORT, face_recognition_info,
+                           true, kSendDataIntervalMiss);
+}
 
-    // Split the normalized data by opencv
-    vector<Mat> temp_splited_image;
-    split(normalized_image[i], temp_splited_image);
+HIAI_StatusT biopsy_inference::SendSuccess(
+  shared_ptr<FaceRecognitionInfo> &face_recognition_info) {
 
-    // Copy data to buffer
-    for (vector<Mat>::iterator
-         splited_data_iter = temp_splited_image.begin();
-         splited_data_iter != temp_splited_image.end(); ++splited_data_iter) {
+  HIAI_ENGINE_LOG("VCNN network run success, the total face is %d .",
+                  face_recognition_info->face_imgs.size());
+  // post process runs on the host, only the JPEG crosses to it
+  EncodeOriginalImage(device_jpeg_quality_, *face_recognition_info);
+  return SendDataWithRetry(this, DEFAULT_DATA_PORT, face_recognition_info,
+                           true, kSendDataIntervalMiss);
+}
 
-      // Change data type to float
-      (*splited_data_iter).convertTo(*splited_data_iter, CV_32FC3);
-      //(*splited_data_iter).convertTo(*splited_data_iter, CV_8U);
-      int splited_data_length = (*splited_data_iter).rows * (*splited_data_iter).cols;
-      int each_size = splited_data_length * sizeof(float);
-      int ret = memcpy_s(tensor_buffer + last_size, each_size, (*splited_data_iter).ptr<float>(0), each_size);
-      if (ret != EOK) {
-        HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                        "memory operation failed in the feature mask's CopyDataToBuffer, error=%d", ret);
-        return 0;
+void biopsy_inference::SampleSignature(const ImageData<u_int8_t> &org_img,
+                                       bool img_aligned,
+                                       const FaceRectangle &rectangle,
+                                       vector<u_int8_t> &signature) {
+  signature.clear();
+  int32_t left = max(0, rectangle.lt.x);
+  int32_t up = max(0, rectangle.lt.y);
+  int32_t right = min(static_cast<int32_t>(org_img.width), rectangle.rb.x);
+  int32_t down = min(static_cast<int32_t>(org_img.height), rectangle.rb.y);
+  if (org_img.data == nullptr || right <= left || down <= up) {
+    return;
+  }
+
+  // center of every grid cell in the Y plane, rows of an aligned image are
+  // padded like ez_dvpp reads an aligned vpc input
+  const u_int8_t *luma = org_img.data.get();
+  uint32_t stride = img_aligned ?
+      AlignUp((org_img.width >> 1) << 1, ascend::utils::kVpcWidthAlign)
+      : org_img.width;
+  signature.reserve(kSignatureGridSize * kSignatureGridSize);
+  for (int32_t row = 0; row < kSignatureGridSize; ++row) {
+    int32_t y = up + (2 * row + 1) * (down - up) / (2 * kSignatureGridSize);
+    for (int32_t col = 0; col < kSignatureGridSize; ++col) {
+      int32_t x = left
+          + (2 * col + 1) * (right - left) / (2 * kSignatureGridSize);
+      signature.push_back(luma[y * stride + x]);
+    }
+  }
+}
+
+void biopsy_inference::ReuseLandmarks(
+  const shared_ptr<FaceRecognitionInfo> &face_recognition_info,
+  vector<vector<u_int8_t>> &signatures, vector<int32_t> &ages,
+  vector<int32_t> &track_indexes, vector<int32_t> &infer_indexes) {
+  vector<FaceImage> &face_imgs = face_recognition_info->face_imgs;
+  signatures.resize(face_imgs.size());
+  ages.assign(face_imgs.size(), kInferredAge);
+  track_indexes.assign(face_imgs.size(), -1);
+  infer_indexes.clear();
+
+  // a frame without face or a lost frame came in between, the faces of
+  // the tracks may have left since
+  uint32_t frame_id = face_recognition_info->frame.frame_id;
+  if (frame_id != tracks_frame_id_ + 1) {
+    tracks_.clear();
+  }
+
+  vector<bool> track_used(tracks_.size(), false);
+  for (size_t i = 0; i < face_imgs.size(); ++i) {
+    const FaceRectangle &rectangle = face_imgs[i].rectangle;
+    SampleSignature(face_recognition_info->org_img,
+                    face_recognition_info->frame.img_aligned, rectangle,
+                    signatures[i]);
+
+    // the unused track whose anchor overlaps the face most
+    int32_t best = -1;
+    float best_iou = 0;
+    for (size_t t = 0; t < tracks_.size(); ++t) {
+      float iou = FaceIou(rectangle, tracks_[t].rectangle);
+      if (!track_used[t] && iou > best_iou) {
+        best = t;
+        best_iou = iou;
       }
+    }
+    bool stationary = (best >= 0) && (best_iou >= reuse_iou_)
+        && (SignatureDiff(signatures[i], tracks_[best].signature)
+            <= reuse_pixel_diff_);
+    if (!stationary) {
+      inferred_faces_++;
+      infer_indexes.push_back(i);
+      continue;
+    }
 
-      // Calcuate the memory's end position
-      last_size += splited_data_length;
+    // the track is consumed even if it is too old, so a stale track is
+    // never matched by another face
+    track_used[best] = true;
+    int32_t age = frame_id - tracks_[best].frame_id;
+    if (age >= refresh_interval_) {
+      refreshed_faces_++;
+      infer_indexes.push_back(i);
+      continue;
     }
+    reused_faces_++;
+    ages[i] = age;
+    track_indexes[i] = best;
+    MoveLandmarks(tracks_[best].rectangle, rectangle, tracks_[best].result,
+                  face_imgs[i].infe_res);
+  }
+
+  if (++cache_frames_ % kReuseLogInterval == 0) {
+    HIAI_ENGINE_LOG("landmark reuse: frames=%" PRIu64 ", reused=%" PRIu64
+                    ", refreshed=%" PRIu64 ", inferred=%" PRIu64, cache_frames_,
+                    reused_faces_, refreshed_faces_, inferred_faces_);
   }
-  return last_size;
 }
 
-bool biopsy_inference::IsDataHandleWrong(shared_ptr<FaceRecognitionInfo> &face_detail_info) {
-  ErrorInfo err_info = face_detail_info->err_info;
-  if (err_info.err_code != AppErrorCode::kNone) {
+void biopsy_inference::ClearTracks() {
+  lock_guard<mutex> lock(tracks_mutex_);
+  tracks_.clear();
+}
+
+void biopsy_inference::CheckProcessThread() {
+  if (refresh_interval_ <= 1) {
+    return;
+  }
+  lock_guard<mutex> lock(tracks_mutex_);
+  thread::id self = this_thread::get_id();
+  if (process_thread_ == thread::id()) {
+    process_thread_ = self;
+  } else if ((process_thread_ != self) && !multi_thread_) {
+    multi_thread_ = true;
+    tracks_.clear();
+    HIAI_ENGINE_LOG("biopsy_inference runs with more than one thread, the "
+                    "order of frames is lost, landmark reuse is disabled");
+  }
+}
+
+void biopsy_inference::UpdateTracks(uint32_t frame_id,
+                                    const vector<FaceImage> &face_imgs,
+                                    vector<vector<u_int8_t>> &signatures,
+                                    const vector<int32_t> &ages,
+                                    const vector<int32_t> &track_indexes) {
+  vector<LandmarkTrack> tracks(face_imgs.size());
+  for (size_t i = 0; i < face_imgs.size(); ++i) {
+    if (ages[i] != kInferredAge) {
+      // reused, the anchor stays where the landmarks were inferred
+      tracks[i] = move(tracks_[track_indexes[i]]);
+      continue;
+    }
+    tracks[i].rectangle = face_imgs[i].rectangle;
+    tracks[i].result = face_imgs[i].infe_res;
+    tracks[i].signature.swap(signatures[i]);
+    tracks[i].frame_id = frame_id;
+  }
+  tracks_.swap(tracks);
+  tracks_frame_id_ = frame_id;
+}
+
+bool biopsy_inference::Estimate(
+  shared_ptr<FaceRecognitionInfo> &face_recognition_info, string &err_log) {
+  // stationary faces reuse the landmarks of the last frame. the tracks are
+  // held from the reuse check to their update, the frames are serialized
+  // only when the reuse is enabled
+  vector<vector<u_int8_t>> signatures;
+  vector<int32_t> ages;
+  vector<int32_t> track_indexes;
+  vector<int32_t> infer_indexes;
+  unique_lock<mutex> tracks_lock(tracks_mutex_, defer_lock);
+  bool reuse = false;
+  if (refresh_interval_ > 1) {
+    tracks_lock.lock();
+    reuse = !multi_thread_;
+    if (!reuse) {
+      tracks_lock.unlock();
+    }
+  }
+  if (reuse) {
+    ReuseLandmarks(face_recognition_info, signatures, ages, track_indexes,
+                   infer_indexes);
+  } else {
+    for (size_t i = 0; i < face_recognition_info->face_imgs.size(); ++i) {
+      infer_indexes.push_back(i);
+    }
+  }
+
+  // 根据face_imgs中存储的的人脸坐标，将人脸从原图像(或金字塔)中扣出来并直接resize到模型需要的大小
+  vector<ImageData<u_int8_t>> resized_imgs;
+  bool crop_flag = CropResize(face_recognition_info, infer_indexes,
+                              resized_imgs);
+  // pyramid is only used by crop, no need to send it to the host
+  face_recognition_info->pyramid.clear();
+  if (!crop_flag) {
+    err_log = "Crop and resize all the data failed, all the data failed";
     return false;
   }
+
+  // Inference the data, the converter normalizes when configured
+  if (!resized_imgs.empty()) {
+    BiopsyContext context;
+    context.resized_imgs = &resized_imgs;
+    context.face_indexes = &infer_indexes;
+    context.face_imgs = &face_recognition_info->face_imgs;
+    context.mean = normalization_ ? normalization_->mean() : nullptr;
+    context.std_dev = normalization_ ? normalization_->std_dev() : nullptr;
+    context.aipp_input = aipp_input_;
+    HIAI_ENGINE_LOG("Inference %d faces by batch %d", resized_imgs.size(),
+                    stage_.batch_size());
+    StageResult stage_ret = stage_.Run(context, resized_imgs.size());
+    if (stage_ret != StageResult::kOk) {
+      err_log = "Inference the data failed";
+      return false;
+    }
+  }
+
+  if (reuse) {
+    UpdateTracks(face_recognition_info->frame.frame_id,
+                 face_recognition_info->face_imgs, signatures, ages,
+                 track_indexes);
+  }
   return true;
 }
 
-HIAI_StatusT biopsy_inference::SendFailed(const string error_log,
-    shared_ptr<FaceRecognitionInfo> &face_recognition_info) {
+bool biopsy_inference::CheckConverter() {
+  // face with gradient luma and chroma, covers the clamp of every channel
+  ImageData<u_int8_t> nv12_img;
+  nv12_img.width = kResizedImgWidth;
+  nv12_img.height = kResizedImgHeight;
+  nv12_img.size = kResizedImgWidth * kResizedImgHeight * kNv12SizeMolecule
+      / kNv12SizeDenominator;
+  nv12_img.data.reset(new (nothrow) u_int8_t[nv12_img.size],
+                      default_delete<u_int8_t[]>());
+  if (nv12_img.data == nullptr) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "new the converter check image error.");
+    return false;
+  }
+  for (uint32_t i = 0; i < nv12_img.size; ++i) {
+    nv12_img.data.get()[i] = static_cast<u_int8_t>(i * 7 + i / kResizedImgWidth);
+  }
+  vector<ImageData<u_int8_t>> nv12_imgs(1, nv12_img);
+
+  const float *mean = normalization_ ? normalization_->mean() : nullptr;
+  const float *std_dev = normalization_ ? normalization_->std_dev() : nullptr;
+  int32_t plane_size = kResizedImgWidth * kResizedImgHeight;
+  vector<float> fused(plane_size * kRgbChannel);
+  Nv12ToPlanarBgr(nv12_img.data.get(), kResizedImgWidth, kResizedImgHeight,
+                  kResizedImgWidth, mean, std_dev, fused.data());
+  vector<Mat> bgr_imgs;
+  ImageYUV2BGR(nv12_imgs, bgr_imgs);
+  if (normalization_ != nullptr) {
+    NormalizeData(bgr_imgs);
+  }
+  vector<Mat> splited_image;
+  split(bgr_imgs[0], splited_image);
+
+  // a normalized value is divided by its std, so is its tolerance
+  float max_diff = 0;
+  for (int32_t c = 0; c < kRgbChannel; ++c) {
+    const float *reference = splited_image[c].ptr<float>(0);
+    for (int32_t i = 0; i < plane_size; ++i) {
+      float scale = (std_dev == nullptr) ? 1.0f
+          : fabs(std_dev[i * kRgbChannel + c]);
+      max_diff = max(max_diff,
+                     fabs(fused[c * plane_size + i] - reference[i]) * scale);
+    }
+  }
+  if (max_diff > kConverterMaxDiff) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INIT_FAILED,
+                    "converter check failed: max diff=%f pixel levels, "
+                    "tolerance=%f", max_diff, kConverterMaxDiff);
+    return false;
+  }
+  HIAI_ENGINE_LOG("converter check: max diff=%f pixel levels", max_diff);
+  return true;
+}
 
-  HIAI_ENGINE_LOG("VCNN network run error");
-  ErrorInfo err_info = face_recognition_info->err_info;
-  err_info.err_code = AppErrorCode::kFeatureMask;
-  err_info.err_msg = error_log;
-  HIAI_StatusT ret = HIAI_OK;
-  do {
-    ret = SendData(DEFAULT_DATA_PORT, "FaceRecognitionInfo",
-                   static_pointer_cast<void>(face_recognition_info));
-    if (ret == HIAI_QUEUE_FULL) {
-      HIAI_ENGINE_LOG("Queue is full, sleep %d ms", HIAI_QUEUE_FULL);
-      usleep(kSendDataIntervalMiss);
+bool biopsy_inference::WarmUp() {
+  if (stage_.warm_up_times() == 0) {
+    return true;
+  }
+
+  shared_ptr<FaceRecognitionInfo> warm_up_info = CreateWarmUpFrame();
+  if (warm_up_info == nullptr) {
+    return false;
+  }
+
+  // one face in the middle of the frame
+  FaceImage face_img;
+  face_img.rectangle.lt.x = (kWarmUpFrameWidth - kWarmUpFaceSize) / 2;
+  face_img.rectangle.lt.y = (kWarmUpFrameHeight - kWarmUpFaceSize) / 2;
+  face_img.rectangle.rb.x = face_img.rectangle.lt.x + kWarmUpFaceSize;
+  face_img.rectangle.rb.y = face_img.rectangle.lt.y + kWarmUpFaceSize;
+
+  for (int32_t i = 0; i < stage_.warm_up_times(); ++i) {
+    // every warm-up run must reach the model, never reuse the last one
+    ClearTracks();
+    warm_up_info->face_imgs.assign(1, face_img);
+    string err_log;
+    if (!Estimate(warm_up_info, err_log)) {
+      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                      "biopsy warm-up failed, %s", err_log.c_str());
+      return false;
     }
-  } while (ret == HIAI_QUEUE_FULL);
+  }
 
-  return ret;
+  // warm-up is not part of the running timing, and its face is no track
+  stage_.ResetStats();
+  ClearTracks();
+  return true;
 }
 
-HIAI_StatusT biopsy_inference::SendSuccess(
-  shared_ptr<FaceRecognitionInfo> &face_recognition_info) {
+void biopsy_inference::RecordThroughput(uint64_t face_num) {
+  int64_t now_us = chrono::duration_cast<chrono::microseconds>(
+      chrono::steady_clock::now().time_since_epoch()).count();
+  int64_t first_us = 0;
+  first_frame_us_.compare_exchange_strong(first_us, now_us);
 
-  HIAI_ENGINE_LOG("VCNN network run success, the total face is %d .",
-                  face_recognition_info->face_imgs.size());
-  HIAI_StatusT ret = HIAI_OK;
-  do {
-    ret = SendData(DEFAULT_DATA_PORT, "FaceRecognitionInfo",
-                   static_pointer_cast<void>(face_recognition_info));
-    if (ret == HIAI_QUEUE_FULL) {
-      HIAI_ENGINE_LOG("Queue is full, sleep 200ms");
-      usleep(kSendDataIntervalMiss);
-    }
-  } while (ret == HIAI_QUEUE_FULL);
+  uint64_t frames = ++handled_frames_;
+  uint64_t faces = (handled_faces_ += face_num);
+  if (frames % kThroughputLogInterval != 0) {
+    return;
+  }
 
-  return ret;
+  double seconds = (now_us - first_frame_us_.load()) / 1000000.0;
+  if (seconds > 0) {
+    HIAI_ENGINE_LOG("throughput: frames=%" PRIu64 ", faces=%" PRIu64
+                    ", %.2f frames/s, %.2f faces/s", frames, faces,
+                    frames / seconds, faces / seconds);
+  }
 }
 
 HIAI_IMPL_ENGINE_PROCESS("biopsy_inference", biopsy_inference, INPUT_SIZE)
@@ -689,7 +1015,6 @@ HIAI_IMPL_ENGINE_PROCESS("biopsy_inference", biopsy_inference, INPUT_SIZE)
     // If not correct, Send the message to next node directly
     shared_ptr<FaceRecognitionInfo> face_recognition_info = static_pointer_cast <
         FaceRecognitionInfo > (arg0);
-    face_recognition_info2 = face_recognition_info;
     if (!IsDataHandleWrong(face_recognition_info)) {
         HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
                         "The message status is not normal");
@@ -698,48 +1023,19 @@ HIAI_IMPL_ENGINE_PROCESS("biopsy_inference", biopsy_inference, INPUT_SIZE)
         return HIAI_ERROR;
     }
     // 没有检测到合格的人脸，所以不需要推理，直接发送结果给post process
+    // (face detection sends such frames to post process directly, keep it
+    // for the graph without that connection)
     if (face_recognition_info->face_imgs.size() == 0) {
         HIAI_ENGINE_LOG("No face image need to be handled.");
         return SendSuccess(face_recognition_info);
     }
     
-    // 根据face_imgs中存储的的人脸坐标，将人脸图像数据从原图像中扣出来放到face_imgs中的image中
-    if (!Crop(face_recognition_info, face_recognition_info->org_img, face_recognition_info->face_imgs)) {
-        return SendFailed("Crop all the data failed, all the data failed",
-                        face_recognition_info);
-    }
-    
-    // 将face_imgs的image图像resize到模型需要的大小，存放在resized_imgs中
-    vector<ImageData<u_int8_t>> resized_imgs;
-    if (!Resize(face_recognition_info->face_imgs, resized_imgs)) {
-        return SendFailed("Resize all the data failed, all the data failed",
-                        face_recognition_info);
-    }
-
-    //yuv420 Inference
-    // bool inference_flag = Inference(resized_imgs, face_recognition_info);
-    // if (!inference_flag) {
-    //    return SendFailed("Inference the data failed",
-    //                    face_recognition_info);
-    // }
-    
-    vector<Mat> bgr_imgs;
-    if (!ImageYUV2BGR(resized_imgs, bgr_imgs)) {
-        return SendFailed("Convert all the data failed, all the data failed",
-                        face_recognition_info);
-    }
-
-    //  if (!NormalizeData(bgr_imgs)) {
-    //     return SendFailed("Normalize all the data failed, all the data failed",
-    //                     face_recognition_info);
-    // }
-
-    // Inference the data
-    bool inference_flag = Inference(bgr_imgs, face_recognition_info->face_imgs);
-    if (!inference_flag) {
-        return SendFailed("Inference the data failed",
-                        face_recognition_info);
+    string err_log;
+    CheckProcessThread();
+    if (!Estimate(face_recognition_info, err_log)) {
+        return SendFailed(err_log, face_recognition_info);
     }
+    RecordThroughput(face_recognition_info->face_imgs.size());
 
     return SendSuccess(face_recognition_info);
     return HIAI_OK;
@@ -17,8 +17,16 @@
 #include "hiaiengine/data_type_reg.h"
 #include "hiaiengine/ai_tensor.h"
 #include "biopsy_estimate_params.h"
+#include "device_jpeg_encoder.h"
+#include "inference_stage.h"
+#include "normalization_sidecar.h"
+#include "startup_timer.h"
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <dirent.h>
 #include <memory>
 #include <unistd.h>
@@ -30,12 +38,23 @@
 #define INPUT_SIZE 2
 #define OUTPUT_SIZE 1
 #define DEFAULT_DATA_PORT 0
-#define AI_MODEL_PROCESS_TIMEOUT 0
+
+// model need BGR float image of 224 * 224, planar, or NV12 image of
+// 224 * 224 when the model is converted with AIPP
+#define RESIZE_WIDTH 224
+#define RESIZE_HEIGHT 224
+#define RGB_CHANNEL 3
 
 class biopsy_inference : public hiai::Engine {
 public:
     biopsy_inference() :
-        input_que_(INPUT_SIZE),batch_size_(1) {}
+        input_que_(INPUT_SIZE), normalize_(false), aipp_input_(false),
+        handled_frames_(0),
+        handled_faces_(0), first_frame_us_(0), tracks_frame_id_(0),
+        multi_thread_(false), refresh_interval_(0),
+        reuse_iou_(0), reuse_pixel_diff_(0), reused_faces_(0),
+        refreshed_faces_(0), inferred_faces_(0), cache_frames_(0),
+        device_jpeg_quality_(0) {}
     HIAI_StatusT Init(const hiai::AIConfig& config, const std::vector<hiai::AIModelDescription>& model_desc);
     /**
     * @ingroup hiaiengine
@@ -46,17 +65,182 @@ public:
 private:
     // Private implementation a member variable, which is used to cache the input queue
     hiai::MultiTypeQueue input_que_;
-    int32_t batch_size_;
 
-    // AI module manager
-    std::shared_ptr<hiai::AIModelManager> ai_model_manager_;
+    /**
+    * @brief: per invocation data of the biopsy stage
+    */
+    struct BiopsyContext {
+        // resized NV12 image of every face which needs inference
+        const std::vector<hiai::ImageData<u_int8_t>> *resized_imgs;
+        // index in face_imgs of every item in resized_imgs
+        const std::vector<int32_t> *face_indexes;
+        std::vector<FaceImage> *face_imgs;  // inference result of every face
+        const float *mean;  // per-pixel BGR mean, nullptr means no normalize
+        const float *std_dev;  // per-pixel BGR std
+        // the model converts and normalizes NV12 by AIPP, copy it as is
+        bool aipp_input;
+    };
+
+    /**
+    * @brief: biopsy pre-process policy, NV12 converted to planar BGR float
+    *   in one pass, or copied as uint8 for the AIPP model
+    */
+    struct BiopsyPreProcessor {
+        typedef BiopsyContext Context;
+        static const uint32_t kItemSize =
+            RESIZE_WIDTH * RESIZE_HEIGHT * RGB_CHANNEL * sizeof(float);
+        static const uint32_t kAippItemSize = RESIZE_WIDTH * RESIZE_HEIGHT
+            * kNv12SizeMolecule / kNv12SizeDenominator;
+        static bool PreProcess(Context &context, int32_t index, uint8_t *slot);
+    };
 
-    // Mean value after trained
+    /**
+    * @brief: biopsy post-process policy, face points and head pose
+    */
+    struct BiopsyPostProcessor {
+        static bool PostProcess(
+            BiopsyContext &context, int32_t index, int32_t slot,
+            const std::vector<std::shared_ptr<hiai::IAITensor>> &output_data_vec);
+    };
+
+    // model execution of the biopsy model
+    InferenceStage<BiopsyPreProcessor, BiopsyPostProcessor> stage_;
+
+    // mean and std after trained, mapped from the sidecar of the model,
+    // nullptr when not normalized by CPU
+    std::shared_ptr<const NormalizationSidecar> normalization_;
+
+    // Mean value after trained, refers to normalization_
     cv::Mat train_mean_;
 
-    // Std value after trained
+    // Std value after trained, refers to normalization_
     cv::Mat train_std_;
 
+    // normalize the model input by train mean and std or not
+    bool normalize_;
+
+    // the model is converted with AIPP and takes uint8 NV12, colour
+    // conversion and normalization run on the device instead of here
+    bool aipp_input_;
+
+    // throughput of all engine threads, every Process only uses its own
+    // message, so thread_num can be larger than 1
+    std::atomic<uint64_t> handled_frames_;
+    std::atomic<uint64_t> handled_faces_;
+    // steady clock time of the first frame (unit: microseconds)
+    std::atomic<int64_t> first_frame_us_;
+
+    /**
+    * @brief: landmark result of a face in the previous frame. The
+    *   box and the signature are the anchor of the frame the result was
+    *   inferred in, a reused frame does not move them, so slow motion can
+    *   not drift past the thresholds step by step
+    */
+    struct LandmarkTrack {
+        FaceRectangle rectangle;  // face position when inferred
+        InferenceResult result;  // landmark and head pose of the face
+        std::vector<u_int8_t> signature;  // luma grid sampled when inferred
+        uint32_t frame_id = 0;  // frame the result was inferred in
+    };
+
+    // face tracks of the last frame, guarded by tracks_mutex_. the reuse
+    // check, the inference and the update of a frame hold it as one
+    // critical section, so frames of several threads do not interleave
+    std::vector<LandmarkTrack> tracks_;
+    std::mutex tracks_mutex_;
+
+    // frame the tracks were updated by. frames without face never reach
+    // this engine, tracks of any frame but the previous one are dropped,
+    // so a face which left is not matched by whoever comes back
+    uint32_t tracks_frame_id_;
+
+    // the reuse depends on the order of the frames, which only one engine
+    // thread keeps. The first thread running Process is recorded, any other
+    // one turns the reuse off for good. Guarded by tracks_mutex_
+    std::thread::id process_thread_;
+    bool multi_thread_;
+
+    // a result is reused at most refresh_interval_ - 1 frames,
+    // 0 or 1 disables the reuse
+    int32_t refresh_interval_;
+
+    // least IoU of the face box with the track to reuse its result
+    float reuse_iou_;
+
+    // most average luma difference of the face with the track
+    float reuse_pixel_diff_;
+
+    // reuse counters, guarded by tracks_mutex_
+    uint64_t reused_faces_;  // result reused from the track
+    uint64_t refreshed_faces_;  // stationary, but inferred as track too old
+    uint64_t inferred_faces_;  // new or moved face
+    uint64_t cache_frames_;
+
+    // JPEG quality of frames sent to the host, 0 means off
+    int32_t device_jpeg_quality_;
+
+    /*
+    * @brief: Sample a grid of luma values inside the face, used to detect
+    *   pixel change of a stationary face box
+    * @param [in]: org_img Original image, NV12
+    * @param [in]: img_aligned Rows of org_img are aligned for vpc or not
+    * @param [in]: rectangle Face position
+    * @param [out]: signature Sampled luma values
+    */
+    void SampleSignature(const hiai::ImageData<u_int8_t> &org_img,
+                         bool img_aligned, const FaceRectangle &rectangle,
+                         std::vector<u_int8_t> &signature);
+
+    /*
+    * @brief: Find the faces whose landmarks can be reused from the last
+    *   frame, the reused results are written into face_imgs. The tracks
+    *   are dropped first unless they are of the previous frame.
+    *   Called with tracks_mutex_ held
+    * @param [in]: face_recognition_info->org_img Original image
+    * @param [in]: face_recognition_info->face_imgs Faces of the frame
+    * @param [out]: signatures Luma signature of every face
+    * @param [out]: ages Age of every face result, -1 means need inference
+    * @param [out]: track_indexes Track reused by every face, -1 for none
+    * @param [out]: infer_indexes Faces which need inference
+    */
+    void ReuseLandmarks(
+        const std::shared_ptr<FaceRecognitionInfo> &face_recognition_info,
+        std::vector<std::vector<u_int8_t>> &signatures,
+        std::vector<int32_t> &ages, std::vector<int32_t> &track_indexes,
+        std::vector<int32_t> &infer_indexes);
+
+    /*
+    * @brief: Replace the tracks by the faces of this frame, a reused face
+    *   keeps the anchor of its track. Called with tracks_mutex_ held
+    * @param [in]: frame_id Frame of the faces
+    * @param [in]: face_imgs Faces with inference result
+    * @param [in]: signatures Luma signature of every face
+    * @param [in]: ages Age of every face result, -1 means just inferred
+    * @param [in]: track_indexes Track reused by every face, -1 for none
+    */
+    void UpdateTracks(uint32_t frame_id,
+                      const std::vector<FaceImage> &face_imgs,
+                      std::vector<std::vector<u_int8_t>> &signatures,
+                      const std::vector<int32_t> &ages,
+                      const std::vector<int32_t> &track_indexes);
+
+    /*
+    * @brief: Forget the faces of the last frame
+    */
+    void ClearTracks();
+
+    /*
+    * @brief: Record the thread running Process, the landmark reuse is
+    *   disabled when a second thread shows up (thread_num > 1)
+    */
+    void CheckProcessThread();
+
+    /*
+    * @brief: Count the handled frame and log throughput periodically
+    * @param [in]: face_num Faces in the frame
+    */
+    void RecordThroughput(uint64_t face_num);
+
     /*
     * Define the face feature position
     */
@@ -74,41 +258,41 @@ private:
     };
 
     /*
-    * @brief: Init the AI model, load the graph.config and based
-    *   on the model path,load the model
-    * @param [in]: config: configuration in graph.config
+    * @brief: Init the normlized mean and std value, the data source is the
+    *   sidecar file made by script/make_normalization_sidecar.py
+    * @param [in]: path Sidecar file
     * @return: Whether init success
     */
-    bool InitAiModel(const hiai::AIConfig &config);
+    bool InitNormlizedData(const std::string &path);
 
     /*
-    * @brief: Init the normlized mean and std value, the data source is from
-    *   trainMean.png and trainSTD.png
-    * @return: Whether init success
+    * @brief: Select the smallest pyramid level whose face crop still covers
+    *   the model input size
+    * @param [in]: face_recognition_info->pyramid Down-scaled original image
+    * @param [in]: rectangle Face position based on the original image
+    * @return: Index in the pyramid, -1 means the original image
     */
-    bool InitNormlizedData();
+    int32_t SelectPyramidLevel(
+        const std::shared_ptr<FaceRecognitionInfo> &face_recognition_info,
+        const FaceRectangle &rectangle);
 
     /*
-    * @brief: Crop the face from original image base on the face coordinate
-    *   Invoke the ez_dvpp interface to do the crop action
+    * @brief: Crop the face from original image (or its pyramid) base on the
+    *   face coordinate and resize it to the model input size in one vpc.
+    *   Invoke the ez_dvpp interface to do the crop and resize action, the
+    *   faces run in parallel on the shared worker pool
     * @param [in]: face_recognition_info->frame Frame info
-    * @param [in]: org_img The original image information
-    * @param [in]: face_imgs->rectangle Face points based on the original image,
-    *   face_imgs->images Face image data after cropped, NV12
-    * @return: Whether init success
+    * @param [in]: face_recognition_info->org_img The original image information
+    * @param [in]: face_recognition_info->face_imgs->rectangle Face points
+    *   based on the original image
+    * @param [in]: face_indexes Faces to crop
+    * @param [out]: resized_imgs Face image data after resized, NV12
+    * @return: Whether crop and resize success
     */
-    bool Crop(const std::shared_ptr<FaceRecognitionInfo> &face_recognition_info, const hiai::ImageData<u_int8_t> &org_img,
-                std::vector<FaceImage> &face_imgs);
-
-    /*
-    * @brief: Resize the face from cropped image base on the face size 40*40
-    *   Invoke the ez_dvpp interface to do the resize action
-    * @param [in]: face_imgs->image Image data after cropped
-    * @param [in]: resized_image Face info after resize
-    * @return: Whether init success
-    */
-    bool Resize(const std::vector<FaceImage> &face_imgs,
-                std::vector<hiai::ImageData<u_int8_t>> &resized_image);
+    bool CropResize(
+        const std::shared_ptr<FaceRecognitionInfo> &face_recognition_info,
+        const std::vector<int32_t> &face_indexes,
+        std::vector<hiai::ImageData<u_int8_t>> &resized_imgs);
 
     /*
     * @brief: Transform the image from resized YUV image to BGR image
@@ -130,25 +314,6 @@ private:
     */
     bool NormalizeData (std::vector<cv::Mat> &normalized_image);
 
-    /*
-    * @brief: Inference the data by the FWK's Process interface
-    * @param [in]: normalized_image The data after normalization
-    * @param [in]: face_imgs->feature_mask The inference result
-    * @return: Whether init success
-    */
-     bool Inference(std::vector<cv::Mat> &normalized_image,
-                     std::vector<FaceImage> &face_imgs);
-    // bool Inference(std::vector<hiai::ImageData<u_int8_t>> resized_imgs,
-    //                                   shared_ptr<FaceRecognitionInfo> face_recognition_info);
-
-    /*
-    * @brief: Copy the data from Mat to Memory Buffer
-    * @param [in]: normalized_image The original data after normalized
-    * @param [in]: number How many Mat need to be fulfilled
-    */
-    void EnrichDataByLastMat(std::vector<cv::Mat> &normalized_image,
-                            int number);
-
     /*
     * @brief: Enrich the face's position by inference result
     * @param [in]: face_position Face position array
@@ -157,16 +322,6 @@ private:
     void EnrichFacePosition(int *face_position,
                             FaceFeature* face_feature);
 
-    /*
-    * @brief: Copy the data from Mat to Memory Buffer
-    * @param [in]: normalized_image The data after normalized
-    * @param [in]: start_index start index in the splited_image data.
-    * @param [in]: tensor_buffer The buffer for the inference
-    * @return: Handle result
-    */
-    int CopyDataToBuffer(std::vector<cv::Mat> &normalized_image,
-                        int start_index, float* tensor_buffer);
-
     /*
     * @brief: Arrange the inference result from result_tensor to face_imgs->feature_mask
     * param [in]: result_tensor Inference result in the face_imgs
@@ -179,6 +334,30 @@ private:
         int start_number, int end_number,
         std::vector<FaceImage> &face_imgs);
 
+    /*
+    * @brief: Compare the fused NV12 converter with the opencv path
+    *   (ImageYUV2BGR, NormalizeData, split) on a synthetic face once
+    * @return: true: every value is within kConverterMaxDiff pixel levels;
+    *   false: the converter is wrong or out of memory
+    */
+    bool CheckConverter();
+
+    /*
+    * @brief: Crop, resize and convert the faces, then inference them
+    * param [in]: face_recognition_info->org_img Original image
+    * param [out]: face_recognition_info->face_imgs Inference result of faces
+    * param [out]: err_log Error log info when failed
+    * @return: Whether estimate success
+    */
+    bool Estimate(std::shared_ptr<FaceRecognitionInfo> &face_recognition_info,
+                  std::string &err_log);
+
+    /*
+    * @brief: Run a synthetic face through Estimate, the result is not sent
+    * @return: Whether warm-up success
+    */
+    bool WarmUp();
+
     /*
     * @brief: Judge that whether the data is wrong, if the error is from last
     *   node, pass the data to next node directly
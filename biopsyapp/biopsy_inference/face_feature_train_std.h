@@ -1,149 +0,0 @@
-/**
- * ============================================================================
- *
- * Copyright (C) 2018, Hisilicon Technologies Co., Ltd. All Rights Reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *
- *   1 Redistributions of source code must retain the above copyright notice,
- *     this list of conditions and the following disclaimer.
- *
- *   2 Redistributions in binary form must reproduce the above copyright notice,
- *     this list of conditions and the following disclaimer in the documentation
- *     and/or other materials provided with the distribution.
- *
- *   3 Neither the names of the copyright holders nor the names of the
- *   contributors may be used to endorse or promote products derived from this
- *   software without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
- * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
- * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
- * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
- * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
- * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
- * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
- * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
- * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
- * POSSIBILITY OF SUCH DAMAGE.
- * ============================================================================
- */
-#ifndef FACE_FEATURE_MASK_STD_H_
-#define FACE_FEATURE_MASK_STD_H_
-
-const float kTrainStd[4800] = {58, 61, 66, 57, 59, 65, 56, 58, 65, 54, 58, 65, 53, 57, 65, 53, 56, 65, 53, 56, 65, 53, 56, 65, 53, 55, 64, 52, 55, 63, 52, 54, 62, 52, 53, 60, 52, 53, 59, 52, 52, 57, 
-  51, 51, 56, 51, 51, 55, 51, 51, 54, 51, 50, 54, 51, 50, 53, 51, 50, 53, 50, 50, 53, 51, 50, 53, 51, 50, 53, 51, 50, 53, 51, 50, 54, 51, 50, 54, 51, 51, 55, 51, 52, 57, 52, 
-  52, 58, 52, 53, 59, 52, 54, 61, 53, 55, 62, 53, 56, 64, 53, 56, 65, 53, 56, 65, 53, 57, 65, 53, 57, 65, 54, 58, 65, 55, 58, 65, 57, 59, 65, 58, 60, 66, 57, 59, 65, 55, 58, 
-  65, 54, 57, 65, 53, 56, 65, 53, 56, 64, 53, 55, 64, 52, 55, 63, 52, 54, 62, 52, 54, 61, 52, 53, 59, 51, 52, 58, 51, 51, 56, 50, 50, 55, 50, 50, 54, 50, 49, 53, 50, 49, 52, 
-  50, 48, 51, 49, 48, 50, 49, 48, 50, 49, 48, 50, 49, 48, 50, 50, 48, 50, 50, 48, 51, 49, 48, 51, 50, 49, 52, 50, 49, 53, 50, 50, 54, 51, 51, 56, 51, 52, 57, 52, 53, 59, 52, 
-  54, 61, 52, 55, 62, 52, 55, 64, 53, 56, 64, 53, 56, 65, 53, 57, 65, 54, 57, 65, 54, 58, 65, 56, 59, 65, 58, 60, 65, 56, 59, 65, 55, 58, 65, 54, 57, 65, 53, 56, 64, 53, 56, 
-  64, 52, 55, 63, 52, 54, 62, 52, 53, 61, 51, 53, 59, 51, 52, 58, 50, 51, 56, 50, 50, 54, 50, 49, 53, 49, 48, 51, 49, 48, 50, 49, 47, 49, 49, 47, 49, 48, 47, 48, 48, 46, 48, 
-  48, 46, 48, 48, 46, 48, 48, 47, 48, 48, 47, 48, 48, 47, 49, 49, 47, 50, 49, 48, 51, 50, 49, 53, 50, 50, 54, 51, 51, 56, 51, 52, 58, 51, 53, 60, 52, 54, 61, 52, 54, 62, 52, 
-  55, 64, 53, 56, 64, 53, 56, 65, 53, 56, 65, 54, 57, 64, 56, 58, 65, 57, 59, 65, 55, 58, 64, 55, 58, 65, 53, 56, 64, 53, 56, 64, 52, 55, 63, 52, 54, 62, 51, 53, 61, 51, 53, 
-  59, 51, 52, 58, 50, 51, 56, 50, 50, 55, 50, 49, 53, 49, 48, 52, 49, 48, 50, 48, 47, 49, 48, 46, 48, 48, 46, 47, 47, 45, 46, 47, 45, 46, 47, 45, 46, 47, 45, 46, 47, 45, 46, 
-  48, 46, 47, 48, 46, 48, 48, 47, 49, 49, 48, 50, 49, 49, 52, 50, 49, 53, 50, 50, 55, 50, 51, 56, 51, 52, 58, 51, 53, 60, 51, 53, 61, 52, 54, 62, 52, 55, 63, 53, 56, 64, 53, 
-  56, 64, 54, 57, 64, 55, 58, 64, 57, 59, 65, 55, 58, 64, 54, 57, 64, 53, 56, 63, 52, 55, 63, 52, 54, 62, 51, 53, 61, 51, 53, 60, 50, 52, 58, 50, 51, 57, 50, 50, 56, 49, 50, 
-  54, 49, 49, 53, 49, 49, 52, 49, 48, 50, 48, 47, 49, 47, 46, 47, 47, 45, 46, 46, 44, 44, 46, 44, 44, 46, 44, 44, 46, 44, 44, 47, 44, 45, 47, 45, 46, 48, 46, 48, 48, 47, 49, 
-  49, 48, 51, 49, 49, 52, 49, 49, 53, 49, 49, 54, 50, 50, 55, 50, 51, 57, 50, 51, 58, 50, 52, 59, 51, 53, 61, 51, 54, 62, 52, 55, 63, 53, 56, 64, 53, 56, 64, 55, 58, 64, 56, 
-  59, 64, 55, 57, 64, 54, 56, 64, 52, 55, 63, 52, 54, 62, 51, 54, 61, 50, 53, 60, 50, 52, 59, 50, 51, 57, 49, 51, 56, 49, 50, 55, 49, 50, 54, 49, 50, 54, 49, 49, 53, 49, 48, 
-  51, 48, 47, 49, 48, 46, 47, 47, 44, 45, 46, 43, 44, 46, 43, 43, 46, 43, 43, 46, 43, 44, 47, 44, 45, 48, 45, 47, 48, 47, 49, 49, 48, 51, 49, 49, 52, 49, 49, 53, 49, 49, 54, 
-  49, 49, 54, 49, 50, 55, 49, 50, 56, 49, 51, 57, 50, 51, 58, 50, 52, 60, 51, 54, 61, 52, 54, 63, 52, 55, 63, 53, 56, 64, 55, 58, 64, 56, 59, 64, 55, 57, 64, 53, 56, 63, 52, 
-  55, 62, 51, 54, 61, 51, 53, 60, 50, 52, 59, 49, 51, 58, 49, 50, 57, 49, 50, 56, 49, 50, 55, 49, 50, 55, 49, 50, 55, 50, 50, 54, 50, 49, 53, 49, 48, 51, 48, 47, 49, 47, 45, 
-  47, 46, 44, 45, 46, 43, 43, 46, 43, 43, 46, 43, 44, 47, 45, 46, 48, 46, 48, 49, 48, 50, 50, 49, 52, 50, 49, 54, 50, 50, 55, 50, 50, 55, 49, 50, 55, 49, 50, 55, 49, 50, 56, 
-  49, 50, 56, 49, 51, 57, 50, 51, 58, 50, 53, 60, 51, 54, 62, 52, 55, 63, 53, 56, 64, 55, 57, 64, 56, 58, 64, 55, 57, 64, 53, 56, 63, 52, 54, 62, 51, 53, 60, 50, 52, 59, 49, 
-  51, 58, 49, 50, 57, 48, 50, 56, 48, 49, 56, 49, 50, 56, 49, 50, 56, 49, 50, 56, 50, 50, 56, 50, 50, 55, 49, 49, 53, 49, 48, 51, 48, 46, 49, 47, 45, 46, 46, 43, 44, 45, 43, 
-  44, 46, 44, 45, 47, 45, 47, 48, 47, 49, 49, 48, 52, 50, 50, 54, 50, 50, 55, 50, 51, 56, 50, 50, 56, 49, 50, 56, 48, 49, 56, 48, 49, 56, 48, 49, 56, 48, 50, 56, 49, 50, 57, 
-  50, 52, 59, 51, 53, 61, 52, 55, 62, 53, 56, 63, 55, 57, 64, 56, 58, 64, 54, 57, 63, 53, 56, 63, 52, 54, 61, 51, 53, 60, 50, 51, 58, 49, 50, 57, 48, 50, 56, 48, 49, 56, 48, 
-  50, 56, 48, 50, 56, 48, 50, 56, 49, 50, 56, 49, 50, 56, 49, 49, 55, 49, 49, 54, 48, 48, 52, 48, 47, 50, 47, 45, 47, 46, 44, 45, 45, 43, 44, 46, 44, 45, 47, 45, 48, 48, 47, 
-  50, 49, 48, 53, 49, 49, 54, 49, 50, 56, 49, 50, 56, 49, 50, 57, 48, 50, 57, 48, 49, 56, 48, 49, 56, 47, 49, 55, 47, 49, 56, 48, 50, 57, 49, 51, 58, 50, 53, 60, 52, 54, 62, 
-  53, 56, 63, 55, 57, 64, 56, 58, 64, 55, 57, 63, 53, 56, 63, 52, 54, 61, 50, 52, 59, 49, 51, 57, 48, 50, 56, 48, 49, 55, 47, 49, 55, 47, 49, 56, 47, 49, 56, 47, 49, 56, 47, 
-  49, 56, 48, 49, 56, 48, 48, 55, 47, 48, 53, 47, 47, 52, 47, 47, 51, 47, 45, 48, 46, 44, 46, 45, 43, 45, 46, 44, 46, 47, 46, 48, 48, 47, 51, 48, 47, 52, 48, 48, 53, 47, 48, 
-  54, 47, 48, 55, 47, 49, 56, 47, 49, 56, 47, 48, 55, 47, 48, 55, 47, 48, 55, 47, 48, 55, 47, 49, 56, 48, 51, 58, 50, 52, 60, 51, 54, 61, 53, 56, 63, 55, 57, 64, 56, 58, 64, 
-  55, 57, 63, 53, 56, 62, 52, 54, 61, 51, 52, 59, 49, 51, 57, 48, 49, 56, 47, 48, 55, 46, 48, 54, 46, 48, 54, 46, 48, 55, 46, 48, 55, 46, 47, 55, 46, 47, 54, 46, 47, 53, 46, 
-  46, 52, 46, 46, 52, 46, 46, 50, 46, 45, 48, 46, 44, 46, 45, 44, 45, 46, 44, 46, 47, 46, 49, 47, 46, 50, 46, 46, 51, 46, 46, 52, 46, 46, 53, 46, 47, 53, 46, 47, 54, 46, 47, 
-  54, 46, 47, 54, 45, 47, 54, 46, 47, 54, 46, 48, 54, 47, 48, 55, 48, 50, 57, 50, 52, 59, 51, 54, 61, 53, 55, 63, 55, 57, 64, 56, 58, 64, 55, 57, 63, 54, 56, 62, 52, 54, 61, 
-  51, 52, 59, 49, 50, 57, 48, 49, 56, 47, 48, 55, 46, 47, 54, 46, 47, 54, 45, 46, 53, 46, 47, 54, 46, 47, 54, 46, 46, 53, 46, 46, 52, 45, 45, 51, 45, 45, 51, 46, 46, 50, 46, 
-  46, 48, 46, 45, 46, 45, 44, 45, 46, 45, 46, 47, 46, 48, 47, 46, 50, 46, 46, 51, 45, 46, 52, 46, 46, 52, 46, 46, 53, 46, 46, 54, 46, 47, 54, 45, 47, 54, 45, 46, 54, 46, 47, 
-  54, 46, 48, 54, 47, 49, 55, 48, 50, 57, 50, 52, 59, 52, 54, 62, 53, 55, 63, 55, 57, 64, 56, 58, 64, 55, 57, 64, 54, 55, 62, 52, 54, 61, 51, 52, 59, 49, 51, 57, 49, 50, 56, 
-  48, 49, 55, 47, 48, 55, 46, 47, 54, 46, 47, 54, 46, 47, 54, 46, 47, 54, 46, 46, 53, 46, 46, 52, 45, 45, 51, 45, 45, 50, 46, 45, 49, 46, 45, 48, 46, 45, 46, 46, 44, 45, 46, 
-  45, 46, 47, 46, 48, 47, 46, 49, 46, 46, 50, 45, 45, 51, 45, 46, 52, 46, 46, 54, 46, 47, 54, 45, 47, 54, 46, 47, 54, 46, 47, 54, 47, 48, 55, 47, 48, 55, 48, 49, 56, 49, 50, 
-  57, 51, 52, 60, 52, 54, 62, 53, 55, 63, 55, 57, 64, 56, 58, 64, 55, 57, 63, 54, 55, 62, 53, 54, 61, 51, 52, 59, 50, 51, 57, 49, 50, 57, 48, 49, 56, 47, 48, 55, 47, 48, 54, 
-  46, 47, 54, 46, 47, 54, 46, 47, 54, 46, 47, 54, 46, 46, 52, 46, 46, 51, 46, 45, 50, 46, 45, 49, 46, 45, 47, 46, 45, 46, 46, 44, 44, 46, 44, 45, 46, 45, 47, 46, 46, 48, 46, 
-  46, 49, 45, 45, 51, 46, 46, 52, 46, 47, 54, 46, 47, 54, 46, 47, 55, 46, 47, 55, 47, 48, 55, 47, 48, 55, 48, 49, 55, 49, 50, 56, 49, 51, 58, 51, 53, 60, 52, 54, 62, 53, 55, 
-  63, 55, 57, 64, 56, 58, 64, 55, 57, 63, 54, 56, 63, 53, 54, 61, 51, 52, 59, 50, 51, 58, 49, 50, 57, 49, 49, 55, 48, 49, 55, 48, 48, 54, 48, 48, 55, 47, 48, 55, 47, 48, 55, 
-  47, 47, 54, 47, 47, 52, 46, 46, 50, 46, 45, 49, 46, 45, 48, 46, 44, 46, 46, 44, 44, 45, 43, 43, 46, 44, 43, 46, 44, 45, 46, 45, 47, 46, 46, 49, 46, 46, 50, 46, 47, 52, 47, 
-  47, 54, 47, 48, 55, 47, 48, 55, 47, 48, 55, 47, 48, 55, 48, 49, 55, 48, 49, 55, 49, 50, 56, 50, 51, 58, 51, 53, 60, 53, 54, 62, 54, 55, 63, 55, 56, 64, 56, 58, 64, 55, 57, 
-  63, 54, 56, 63, 53, 54, 61, 51, 52, 59, 51, 51, 58, 50, 50, 56, 49, 49, 54, 48, 48, 54, 48, 48, 53, 47, 47, 53, 47, 47, 53, 47, 47, 52, 47, 47, 52, 46, 46, 50, 46, 45, 48, 
-  45, 45, 47, 46, 44, 46, 45, 44, 44, 45, 43, 42, 45, 42, 41, 45, 43, 42, 46, 44, 43, 46, 44, 45, 46, 45, 47, 46, 45, 48, 46, 46, 50, 47, 47, 52, 47, 47, 53, 47, 48, 53, 48, 
-  48, 53, 48, 48, 53, 48, 48, 54, 49, 49, 55, 49, 50, 56, 50, 51, 58, 52, 53, 60, 53, 54, 62, 54, 55, 63, 55, 56, 64, 57, 58, 64, 55, 57, 63, 54, 56, 63, 53, 54, 61, 52, 52, 
-  59, 51, 51, 57, 50, 50, 55, 49, 48, 54, 48, 47, 52, 47, 47, 51, 47, 46, 50, 47, 46, 50, 46, 46, 50, 46, 46, 49, 46, 45, 48, 45, 44, 46, 45, 44, 45, 45, 43, 44, 45, 43, 42, 
-  44, 42, 41, 44, 42, 40, 45, 42, 40, 45, 42, 41, 45, 43, 43, 45, 44, 44, 46, 44, 46, 46, 45, 47, 46, 45, 48, 47, 46, 49, 47, 46, 50, 47, 46, 50, 47, 46, 50, 48, 47, 52, 48, 
-  48, 53, 49, 49, 55, 51, 51, 58, 52, 53, 60, 53, 54, 62, 54, 55, 63, 55, 56, 64, 57, 58, 65, 55, 57, 63, 54, 56, 62, 53, 54, 61, 52, 52, 59, 51, 51, 57, 50, 49, 55, 49, 48, 
-  52, 47, 46, 50, 47, 45, 49, 46, 45, 48, 46, 45, 47, 45, 44, 46, 45, 44, 46, 45, 43, 45, 45, 43, 44, 45, 43, 43, 45, 43, 42, 44, 42, 41, 44, 42, 40, 44, 41, 39, 44, 41, 39, 
-  44, 42, 40, 45, 43, 42, 45, 43, 43, 45, 43, 44, 45, 44, 45, 46, 44, 45, 46, 44, 46, 46, 44, 46, 46, 44, 47, 46, 45, 48, 47, 46, 49, 48, 47, 51, 49, 49, 54, 50, 51, 57, 52, 
-  53, 60, 53, 54, 62, 54, 55, 63, 55, 56, 64, 57, 58, 65, 55, 57, 63, 54, 56, 62, 53, 54, 61, 52, 52, 59, 50, 51, 57, 49, 49, 54, 48, 47, 51, 47, 45, 48, 46, 44, 46, 45, 43, 
-  45, 45, 43, 44, 45, 43, 43, 44, 42, 43, 45, 43, 42, 44, 42, 42, 45, 43, 42, 45, 43, 42, 45, 42, 41, 44, 42, 40, 44, 41, 39, 44, 42, 40, 44, 42, 41, 45, 43, 41, 45, 43, 42, 
-  45, 43, 43, 45, 43, 43, 45, 43, 43, 45, 43, 43, 45, 43, 43, 45, 43, 44, 46, 44, 45, 47, 45, 47, 48, 47, 50, 49, 48, 53, 50, 50, 57, 52, 52, 60, 53, 54, 62, 54, 55, 63, 55, 
-  56, 64, 57, 58, 65, 56, 57, 64, 55, 56, 63, 53, 54, 61, 52, 52, 59, 51, 51, 57, 49, 49, 54, 48, 47, 51, 46, 45, 47, 45, 43, 44, 45, 42, 43, 44, 42, 42, 44, 42, 41, 44, 42, 
-  41, 45, 42, 42, 45, 43, 42, 45, 43, 43, 45, 44, 43, 45, 43, 42, 45, 43, 41, 44, 42, 41, 45, 43, 41, 45, 43, 42, 45, 43, 43, 45, 44, 43, 45, 44, 43, 45, 44, 43, 45, 43, 42, 
-  45, 43, 42, 45, 42, 42, 45, 43, 43, 46, 43, 44, 46, 44, 46, 48, 46, 50, 49, 48, 53, 50, 50, 57, 52, 52, 60, 53, 54, 62, 54, 55, 63, 55, 56, 64, 58, 58, 65, 56, 57, 64, 55, 
-  56, 63, 53, 54, 61, 52, 52, 59, 51, 51, 57, 49, 49, 54, 48, 47, 51, 46, 45, 47, 45, 43, 44, 45, 42, 42, 44, 42, 41, 44, 42, 41, 45, 42, 41, 45, 43, 42, 45, 44, 43, 46, 44, 
-  44, 46, 45, 44, 46, 45, 44, 46, 45, 44, 46, 45, 44, 46, 45, 45, 46, 45, 45, 46, 44, 44, 46, 44, 44, 45, 44, 44, 46, 44, 44, 45, 44, 43, 45, 43, 42, 45, 42, 42, 45, 42, 42, 
-  45, 43, 44, 46, 44, 46, 47, 46, 49, 49, 48, 53, 50, 50, 57, 51, 52, 60, 53, 54, 62, 54, 55, 63, 55, 56, 64, 58, 59, 65, 57, 57, 64, 55, 56, 63, 53, 54, 61, 52, 52, 60, 51, 
-  51, 57, 49, 49, 54, 48, 47, 51, 47, 45, 48, 45, 43, 44, 45, 42, 42, 44, 42, 41, 45, 42, 42, 45, 43, 42, 45, 43, 43, 45, 44, 44, 46, 45, 45, 46, 45, 46, 47, 46, 47, 47, 46, 
-  47, 47, 47, 48, 47, 46, 47, 47, 46, 47, 46, 45, 46, 46, 45, 45, 45, 44, 45, 45, 44, 44, 45, 44, 44, 45, 43, 43, 45, 43, 43, 45, 43, 43, 46, 43, 44, 46, 44, 47, 47, 46, 50, 
-  49, 48, 54, 50, 50, 57, 51, 52, 60, 52, 53, 62, 54, 55, 63, 55, 56, 64, 59, 60, 66, 57, 58, 64, 56, 56, 63, 54, 54, 62, 52, 52, 60, 51, 51, 57, 49, 49, 55, 48, 47, 52, 47, 
-  45, 48, 45, 43, 45, 45, 42, 43, 45, 42, 42, 44, 42, 42, 45, 43, 43, 45, 43, 44, 45, 44, 45, 46, 45, 46, 46, 46, 48, 47, 47, 49, 47, 47, 49, 48, 48, 50, 48, 47, 49, 47, 47, 
-  49, 47, 46, 48, 46, 45, 47, 45, 44, 46, 45, 44, 45, 45, 44, 45, 45, 43, 44, 45, 43, 43, 45, 43, 44, 46, 43, 45, 46, 44, 47, 47, 46, 50, 48, 48, 54, 50, 50, 57, 51, 52, 60, 
-  52, 54, 62, 54, 55, 63, 56, 57, 64, 60, 60, 66, 58, 58, 65, 56, 57, 64, 54, 55, 62, 52, 53, 60, 51, 51, 58, 49, 49, 55, 48, 47, 52, 47, 45, 49, 45, 43, 46, 45, 42, 44, 44, 
-  42, 43, 44, 42, 43, 44, 42, 44, 44, 43, 44, 45, 43, 45, 45, 44, 47, 46, 45, 48, 46, 46, 49, 47, 47, 50, 47, 47, 50, 47, 47, 50, 47, 46, 50, 46, 46, 49, 45, 45, 48, 45, 44, 
-  46, 45, 44, 46, 45, 43, 45, 45, 43, 45, 45, 43, 44, 45, 43, 45, 46, 43, 46, 46, 44, 48, 47, 46, 51, 48, 48, 55, 50, 50, 58, 51, 52, 60, 53, 54, 62, 54, 55, 63, 56, 57, 65, 
-  60, 61, 67, 58, 59, 65, 56, 57, 64, 55, 56, 63, 52, 53, 61, 51, 51, 58, 49, 49, 56, 48, 47, 53, 46, 45, 50, 45, 44, 47, 44, 43, 45, 44, 42, 44, 44, 43, 44, 44, 43, 44, 44, 
-  43, 45, 44, 43, 45, 45, 44, 47, 45, 45, 48, 46, 45, 48, 46, 46, 49, 47, 46, 50, 46, 46, 50, 46, 45, 49, 45, 45, 48, 45, 45, 48, 45, 44, 47, 44, 44, 46, 44, 44, 46, 45, 43, 
-  46, 45, 43, 46, 45, 43, 46, 45, 44, 47, 46, 44, 49, 47, 46, 52, 48, 48, 55, 49, 50, 58, 51, 52, 60, 53, 54, 62, 54, 56, 64, 56, 58, 65, 61, 62, 67, 59, 60, 66, 57, 58, 65, 
-  55, 56, 63, 53, 54, 61, 51, 52, 59, 49, 49, 56, 48, 47, 53, 46, 45, 50, 45, 44, 48, 44, 43, 46, 44, 43, 45, 44, 43, 45, 44, 43, 46, 44, 43, 46, 44, 44, 46, 45, 44, 47, 45, 
-  45, 48, 46, 45, 48, 46, 45, 49, 46, 46, 49, 46, 46, 49, 45, 45, 49, 45, 45, 48, 45, 45, 48, 45, 44, 47, 45, 44, 47, 45, 44, 47, 45, 44, 47, 45, 44, 47, 45, 43, 47, 45, 44, 
-  47, 46, 45, 49, 47, 46, 52, 48, 48, 56, 50, 50, 58, 51, 52, 61, 53, 54, 63, 55, 56, 64, 57, 58, 65, 61, 62, 68, 60, 60, 67, 58, 59, 66, 56, 57, 64, 54, 55, 62, 52, 52, 60, 
-  49, 50, 57, 48, 48, 54, 46, 46, 51, 45, 44, 49, 44, 43, 47, 44, 43, 46, 44, 44, 47, 44, 44, 47, 45, 44, 47, 45, 45, 47, 45, 45, 48, 45, 45, 48, 45, 45, 48, 46, 46, 49, 46, 
-  46, 49, 46, 46, 49, 46, 46, 48, 45, 45, 48, 45, 45, 48, 45, 45, 48, 45, 45, 48, 45, 45, 48, 45, 45, 48, 45, 44, 48, 44, 44, 47, 45, 44, 48, 46, 45, 50, 47, 47, 54, 48, 49, 
-  57, 50, 51, 59, 52, 53, 61, 54, 55, 63, 56, 57, 65, 57, 59, 66, 62, 63, 68, 60, 61, 67, 58, 59, 66, 57, 58, 65, 54, 56, 63, 52, 53, 61, 50, 51, 58, 48, 49, 55, 47, 47, 52, 
-  45, 45, 50, 44, 44, 48, 44, 44, 47, 44, 44, 47, 45, 45, 48, 46, 46, 48, 46, 46, 49, 46, 46, 49, 46, 47, 49, 47, 47, 49, 47, 47, 49, 47, 47, 49, 47, 47, 49, 47, 47, 49, 46, 
-  47, 49, 46, 47, 50, 46, 47, 50, 46, 46, 49, 45, 46, 49, 45, 45, 49, 45, 44, 49, 45, 44, 49, 45, 44, 49, 46, 46, 52, 47, 48, 55, 49, 50, 58, 50, 52, 60, 52, 54, 62, 54, 56, 
-  64, 56, 58, 65, 58, 59, 66, 62, 63, 68, 61, 62, 67, 59, 60, 66, 57, 58, 65, 55, 56, 64, 53, 54, 62, 51, 52, 59, 49, 50, 56, 47, 48, 54, 46, 46, 51, 45, 44, 49, 44, 44, 48, 
-  44, 44, 48, 44, 45, 48, 45, 46, 49, 46, 46, 49, 46, 47, 49, 47, 47, 50, 47, 48, 50, 47, 48, 49, 47, 48, 49, 47, 48, 50, 47, 48, 50, 47, 48, 50, 46, 47, 50, 46, 47, 50, 45, 
-  46, 50, 45, 46, 50, 44, 45, 49, 44, 45, 49, 44, 45, 49, 45, 45, 51, 46, 47, 53, 48, 49, 56, 49, 51, 59, 51, 53, 61, 53, 55, 63, 55, 57, 65, 57, 58, 66, 59, 60, 67, 63, 63, 
-  68, 61, 62, 68, 60, 61, 67, 58, 59, 66, 56, 57, 64, 54, 55, 62, 52, 53, 60, 50, 51, 58, 48, 49, 55, 46, 47, 52, 45, 45, 50, 44, 44, 49, 44, 44, 48, 44, 44, 48, 45, 45, 49, 
-  45, 46, 49, 46, 47, 50, 47, 48, 50, 47, 48, 50, 48, 48, 50, 48, 49, 50, 48, 49, 50, 48, 48, 50, 47, 48, 50, 46, 47, 50, 46, 46, 50, 45, 46, 50, 45, 45, 50, 44, 45, 50, 44, 
-  45, 49, 45, 45, 50, 45, 46, 52, 47, 48, 54, 48, 50, 57, 50, 52, 60, 52, 53, 62, 54, 55, 64, 56, 57, 65, 58, 59, 66, 59, 61, 67, 63, 64, 69, 62, 63, 68, 61, 62, 68, 59, 60, 
-  66, 57, 58, 65, 55, 56, 63, 53, 54, 61, 51, 52, 59, 49, 50, 56, 47, 48, 54, 46, 46, 51, 44, 44, 49, 44, 44, 49, 44, 44, 48, 44, 44, 48, 45, 45, 49, 46, 46, 49, 47, 47, 50, 
-  47, 48, 50, 48, 48, 50, 48, 49, 50, 48, 48, 50, 48, 48, 50, 47, 47, 50, 46, 46, 49, 45, 46, 49, 45, 45, 50, 44, 45, 50, 44, 45, 50, 44, 44, 50, 45, 45, 51, 46, 47, 53, 48, 
-  49, 56, 49, 51, 59, 51, 53, 61, 52, 54, 63, 55, 56, 64, 56, 58, 66, 58, 60, 66, 60, 61, 67, 64, 64, 69, 62, 63, 68, 61, 62, 68, 59, 60, 67, 57, 59, 66, 55, 57, 64, 53, 55, 
-  62, 52, 53, 60, 50, 51, 58, 48, 49, 55, 46, 47, 53, 45, 45, 50, 43, 44, 48, 43, 43, 48, 43, 43, 48, 44, 44, 48, 44, 45, 48, 45, 45, 48, 46, 46, 49, 46, 46, 49, 47, 47, 49, 
-  47, 47, 49, 46, 46, 49, 46, 46, 48, 45, 45, 48, 44, 45, 48, 44, 44, 49, 44, 44, 49, 44, 44, 49, 44, 45, 50, 45, 46, 52, 47, 48, 55, 48, 50, 57, 50, 52, 60, 51, 53, 62, 53, 
-  55, 64, 55, 57, 65, 57, 59, 66, 59, 60, 66, 60, 61, 67, 64, 65, 69, 63, 63, 68, 62, 63, 68, 60, 61, 67, 58, 60, 66, 56, 58, 65, 54, 56, 63, 52, 54, 62, 51, 52, 59, 49, 50, 
-  57, 47, 48, 54, 45, 46, 51, 44, 44, 49, 43, 43, 48, 43, 43, 47, 43, 43, 47, 43, 43, 47, 44, 44, 47, 44, 44, 47, 45, 44, 47, 45, 44, 47, 45, 44, 47, 45, 44, 47, 44, 44, 47, 
-  44, 44, 47, 43, 44, 47, 43, 44, 48, 43, 44, 48, 44, 44, 50, 45, 46, 52, 46, 47, 54, 48, 49, 56, 49, 51, 59, 50, 52, 61, 52, 54, 63, 54, 56, 64, 56, 57, 65, 58, 59, 66, 59, 
-  60, 67, 61, 62, 67, 65, 65, 69, 63, 64, 69, 62, 63, 68, 60, 61, 67, 59, 60, 66, 57, 58, 65, 55, 56, 64, 53, 55, 63, 51, 53, 60, 50, 51, 58, 48, 49, 56, 46, 47, 53, 45, 45, 
-  51, 44, 44, 48, 43, 43, 47, 43, 43, 46, 43, 43, 46, 43, 42, 45, 43, 43, 45, 43, 43, 46, 44, 43, 46, 44, 43, 46, 43, 43, 46, 43, 43, 46, 43, 43, 46, 43, 43, 46, 43, 43, 47, 
-  44, 44, 49, 44, 45, 51, 46, 47, 53, 47, 48, 55, 48, 50, 58, 50, 52, 60, 51, 53, 62, 53, 55, 63, 54, 56, 64, 56, 58, 65, 58, 60, 67, 59, 60, 67, 61, 62, 67, 65, 66, 70, 64, 
-  64, 69, 62, 63, 68, 60, 62, 67, 59, 60, 67, 57, 59, 65, 56, 57, 65, 54, 56, 63, 52, 54, 61, 51, 52, 60, 49, 50, 57, 47, 48, 55, 46, 46, 52, 45, 44, 50, 44, 43, 48, 43, 43, 
-  46, 43, 42, 46, 43, 42, 45, 43, 43, 45, 43, 43, 45, 43, 43, 46, 44, 43, 46, 43, 43, 46, 43, 43, 46, 43, 43, 46, 43, 43, 47, 43, 43, 48, 44, 44, 50, 46, 46, 52, 47, 48, 55, 
-  48, 50, 57, 49, 51, 59, 50, 53, 61, 52, 54, 62, 53, 55, 64, 55, 57, 65, 57, 58, 66, 59, 60, 67, 60, 61, 67, 62, 62, 67, 65, 66, 70, 64, 65, 69, 63, 64, 68, 61, 62, 67, 60, 
-  61, 67, 58, 59, 66, 56, 58, 65, 55, 56, 64, 53, 55, 62, 52, 53, 61, 50, 52, 59, 49, 50, 57, 47, 48, 55, 46, 46, 52, 45, 44, 49, 44, 43, 48, 43, 43, 46, 43, 43, 46, 43, 43, 
-  45, 43, 43, 45, 44, 43, 46, 44, 43, 46, 44, 43, 46, 44, 43, 46, 43, 43, 46, 44, 43, 47, 44, 44, 49, 46, 46, 52, 47, 48, 54, 48, 49, 57, 49, 51, 59, 50, 52, 60, 51, 54, 62, 
-  53, 55, 63, 54, 56, 64, 56, 58, 65, 58, 59, 66, 59, 60, 66, 61, 61, 67, 62, 63, 68, 66, 66, 70, 64, 65, 69, 63, 64, 69, 62, 63, 68, 60, 61, 67, 58, 59, 66, 57, 58, 65, 55, 
-  57, 64, 54, 55, 63, 52, 54, 62, 51, 53, 60, 50, 51, 58, 48, 50, 57, 47, 48, 55, 46, 46, 52, 45, 45, 50, 44, 44, 48, 44, 43, 47, 44, 43, 46, 44, 43, 46, 44, 43, 46, 44, 43, 
-  46, 44, 43, 46, 44, 43, 46, 44, 44, 47, 45, 45, 49, 46, 46, 52, 47, 48, 54, 48, 49, 56, 49, 51, 58, 50, 52, 60, 51, 53, 61, 52, 54, 63, 54, 55, 63, 55, 57, 64, 57, 58, 65, 
-  59, 60, 66, 60, 61, 66, 61, 62, 67, 63, 63, 68, 66, 67, 71, 65, 66, 70, 64, 65, 69, 63, 64, 68, 61, 62, 67, 59, 60, 66, 57, 58, 65, 56, 58, 64, 55, 56, 63, 53, 55, 62, 52, 
-  54, 61, 51, 52, 60, 49, 51, 58, 49, 50, 57, 47, 48, 55, 47, 47, 52, 46, 45, 50, 45, 44, 49, 45, 44, 48, 45, 44, 47, 44, 44, 47, 44, 44, 47, 45, 44, 47, 45, 44, 48, 45, 45, 
-  50, 46, 46, 52, 47, 48, 54, 49, 49, 56, 49, 51, 58, 50, 52, 60, 51, 53, 61, 52, 54, 62, 53, 55, 63, 55, 56, 64, 56, 57, 64, 58, 59, 65, 60, 61, 66, 61, 62, 67, 63, 63, 68, 
-  64, 64, 69, 67, 67, 71, 66, 66, 71, 65, 65, 70, 64, 64, 69, 62, 63, 68, 60, 61, 67, 58, 59, 65, 57, 58, 65, 56, 57, 64, 54, 56, 63, 53, 54, 62, 51, 53, 60, 50, 52, 60, 50, 
-  51, 58, 49, 50, 57, 48, 48, 55, 47, 47, 53, 46, 46, 51, 46, 45, 50, 46, 45, 49, 46, 45, 49, 45, 45, 49, 46, 45, 50, 46, 46, 51, 47, 47, 53, 48, 48, 55, 49, 50, 57, 50, 51, 
-  58, 51, 52, 60, 51, 53, 61, 52, 54, 62, 53, 55, 63, 54, 56, 63, 56, 57, 64, 57, 58, 65, 59, 59, 65, 60, 61, 66, 62, 63, 68, 63, 64, 68, 65, 65, 70, 68, 68, 72, 67, 67, 71, 
-  66, 66, 71, 64, 65, 70, 63, 64, 69, 61, 62, 67, 59, 60, 66, 58, 59, 65, 57, 58, 64, 55, 56, 63, 54, 55, 62, 53, 54, 62, 51, 53, 61, 50, 52, 59, 50, 51, 58, 49, 50, 57, 48, 
-  49, 56, 48, 48, 54, 47, 47, 53, 47, 47, 52, 47, 47, 52, 47, 46, 52, 47, 47, 53, 48, 48, 54, 48, 49, 56, 49, 50, 57, 50, 51, 58, 51, 52, 60, 51, 53, 61, 52, 53, 61, 53, 54, 
-  62, 54, 55, 63, 56, 57, 63, 57, 58, 64, 58, 59, 65, 60, 60, 66, 62, 62, 67, 63, 63, 68, 64, 65, 69, 66, 66, 71};
-
-  #endif
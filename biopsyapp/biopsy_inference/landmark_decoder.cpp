@@ -0,0 +1,66 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#include "landmark_decoder.h"
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define LANDMARK_DECODER_NEON
+#endif
+
+namespace {
+#ifdef LANDMARK_DECODER_NEON
+// points handled by one neon loop
+const int32_t kNeonPoints = 4;
+#endif
+}
+
+void DecodeLandmarks(const float *points, int32_t point_num, float scale_x,
+                     float offset_x, float scale_y, float offset_y, float *x,
+                     float *y) {
+  int32_t i = 0;
+#ifdef LANDMARK_DECODER_NEON
+  const float32x4_t offset_x4 = vdupq_n_f32(offset_x);
+  const float32x4_t offset_y4 = vdupq_n_f32(offset_y);
+  for (; i + kNeonPoints <= point_num; i += kNeonPoints) {
+    // de-interleave 4 points into x and y lanes
+    float32x4x2_t xy = vld2q_f32(points + 2 * i);
+    vst1q_f32(x + i, vmlaq_n_f32(offset_x4, xy.val[0], scale_x));
+    vst1q_f32(y + i, vmlaq_n_f32(offset_y4, xy.val[1], scale_y));
+  }
+#endif
+  for (; i < point_num; ++i) {
+    x[i] = points[2 * i] * scale_x + offset_x;
+    y[i] = points[2 * i + 1] * scale_y + offset_y;
+  }
+}
+
+void MapLandmarks(const float *x_in, const float *y_in, int32_t point_num,
+                  float scale_x, float offset_x, float scale_y,
+                  float offset_y, float *x, float *y) {
+  int32_t i = 0;
+#ifdef LANDMARK_DECODER_NEON
+  const float32x4_t offset_x4 = vdupq_n_f32(offset_x);
+  const float32x4_t offset_y4 = vdupq_n_f32(offset_y);
+  for (; i + kNeonPoints <= point_num; i += kNeonPoints) {
+    vst1q_f32(x + i, vmlaq_n_f32(offset_x4, vld1q_f32(x_in + i), scale_x));
+    vst1q_f32(y + i, vmlaq_n_f32(offset_y4, vld1q_f32(y_in + i), scale_y));
+  }
+#endif
+  for (; i < point_num; ++i) {
+    x[i] = x_in[i] * scale_x + offset_x;
+    y[i] = y_in[i] * scale_y + offset_y;
+  }
+}
+
+void DecodePose(const float *output, int32_t pose_num, float scale,
+                float *pose) {
+  for (int32_t i = 0; i < pose_num; ++i) {
+    pose[i] = output[i] * scale;
+  }
+}
@@ -0,0 +1,49 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef LANDMARK_DECODER_H_
+#define LANDMARK_DECODER_H_
+
+#include <stdint.h>
+
+/**
+ * @brief: map interleaved landmark output (x0, y0, x1, y1, ...) straight
+ *         from the tensor buffer to separate x and y arrays by
+ *         x = point_x * scale_x + offset_x, y = point_y * scale_y + offset_y
+ * @param [in]: points: 2 * point_num floats of the model output
+ * @param [in]: point_num: number of points
+ * @param [in]: scale_x, offset_x, scale_y, offset_y: linear mapping
+ * @param [out]: x, y: point_num floats each
+ */
+void DecodeLandmarks(const float *points, int32_t point_num, float scale_x,
+                     float offset_x, float scale_y, float offset_y, float *x,
+                     float *y);
+
+/**
+ * @brief: apply x = x_in * scale_x + offset_x, y = y_in * scale_y + offset_y
+ *         to separate x and y arrays, in place is allowed
+ * @param [in]: x_in, y_in: point_num floats each
+ * @param [in]: point_num: number of points
+ * @param [in]: scale_x, offset_x, scale_y, offset_y: linear mapping
+ * @param [out]: x, y: point_num floats each
+ */
+void MapLandmarks(const float *x_in, const float *y_in, int32_t point_num,
+                  float scale_x, float offset_x, float scale_y,
+                  float offset_y, float *x, float *y);
+
+/**
+ * @brief: scale pose output, pose = output * scale
+ * @param [in]: output: pose_num floats of the model output
+ * @param [in]: pose_num: number of pose values
+ * @param [in]: scale: scale of the pose
+ * @param [out]: pose: pose_num floats
+ */
+void DecodePose(const float *output, int32_t pose_num, float scale,
+                float *pose);
+
+#endif /* LANDMARK_DECODER_H_ */
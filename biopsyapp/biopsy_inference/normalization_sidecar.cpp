@@ -0,0 +1,124 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#include "normalization_sidecar.h"
+
+#include <map>
+#include <mutex>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hiaiengine/log.h"
+
+using namespace std;
+
+namespace {
+// mappings of the process, an entry expires with its last user
+mutex g_sidecars_mutex;
+map<string, weak_ptr<const NormalizationSidecar>> g_sidecars;
+}
+
+shared_ptr<const NormalizationSidecar> NormalizationSidecar::Load(
+    const string &path, uint32_t height, uint32_t width, uint32_t channels) {
+  lock_guard<mutex> lock(g_sidecars_mutex);
+  shared_ptr<const NormalizationSidecar> sidecar = g_sidecars[path].lock();
+  if (sidecar == nullptr) {
+    sidecar = Map(path, height, width, channels);
+    g_sidecars[path] = sidecar;
+    return sidecar;
+  }
+
+  // shared by an engine with the same model, the shape is still checked
+  const NormalizationSidecarHeader *header =
+      static_cast<const NormalizationSidecarHeader *>(sidecar->addr_);
+  if (header->height != height || header->width != width
+      || header->channels != channels) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                    "normalization %s is %ux%ux%u, model input is %ux%ux%u",
+                    path.c_str(), header->height, header->width,
+                    header->channels, height, width, channels);
+    return nullptr;
+  }
+  return sidecar;
+}
+
+string NormalizationSidecar::PathOfModel(const string &model_path) {
+  string::size_type slash = model_path.find_last_of('/');
+  string::size_type dot = model_path.find_last_of('.');
+  if (dot == string::npos || (slash != string::npos && dot < slash)) {
+    return model_path + kNormalizationSidecarExt;
+  }
+  return model_path.substr(0, dot) + kNormalizationSidecarExt;
+}
+
+shared_ptr<const NormalizationSidecar> NormalizationSidecar::Map(
+    const string &path, uint32_t height, uint32_t width, uint32_t channels) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                    "open normalization %s failed", path.c_str());
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                    "stat normalization %s failed", path.c_str());
+    close(fd);
+    return nullptr;
+  }
+
+  size_t count = static_cast<size_t>(height) * width * channels;
+  size_t size = sizeof(NormalizationSidecarHeader) + 2 * count * sizeof(float);
+  if (static_cast<size_t>(file_stat.st_size) != size) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                    "normalization %s size is %lld, %ux%ux%u needs %zu",
+                    path.c_str(), static_cast<long long>(file_stat.st_size),
+                    height, width, channels, size);
+    close(fd);
+    return nullptr;
+  }
+
+  // the mapping keeps the file, no need to keep the fd
+  void *addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                    "mmap normalization %s failed", path.c_str());
+    return nullptr;
+  }
+
+  const NormalizationSidecarHeader *header =
+      static_cast<const NormalizationSidecarHeader *>(addr);
+  const float *mean = reinterpret_cast<const float *>(header + 1);
+  shared_ptr<const NormalizationSidecar> sidecar(
+      new NormalizationSidecar(addr, size, mean, mean + count));
+  if (header->magic != kNormalizationSidecarMagic
+      || header->version != kNormalizationSidecarVersion) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                    "normalization %s is not a version %u sidecar",
+                    path.c_str(), kNormalizationSidecarVersion);
+    return nullptr;
+  }
+  if (header->height != height || header->width != width
+      || header->channels != channels) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                    "normalization %s is %ux%ux%u, model input is %ux%ux%u",
+                    path.c_str(), header->height, header->width,
+                    header->channels, height, width, channels);
+    return nullptr;
+  }
+  HIAI_ENGINE_LOG("normalization %s mapped, %ux%ux%u", path.c_str(), height,
+                  width, channels);
+  return sidecar;
+}
+
+NormalizationSidecar::~NormalizationSidecar() {
+  munmap(addr_, size_);
+}
@@ -0,0 +1,92 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef NORMALIZATION_SIDECAR_H_
+#define NORMALIZATION_SIDECAR_H_
+
+#include <memory>
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+// file extension of the sidecar, it is placed next to the model file
+const char kNormalizationSidecarExt[] = ".norm";
+
+// "BNRM" in little endian
+const uint32_t kNormalizationSidecarMagic = 0x4D524E42;
+const uint32_t kNormalizationSidecarVersion = 1;
+
+/**
+ * @brief: file header of the sidecar, followed by the mean and then the std
+ *         of every pixel, both height * width * channels little endian
+ *         floats in HWC (BGR interleaved) order
+ */
+struct NormalizationSidecarHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t height;
+  uint32_t width;
+  uint32_t channels;
+  uint32_t reserved[3];  // zero, keeps the floats 32 bytes aligned
+};
+
+/**
+ * @brief: mean and std of the model input, mapped read-only from the
+ *         sidecar file. Engines which load the same file share one mapping.
+ */
+class NormalizationSidecar {
+ public:
+  /**
+   * @brief: map the sidecar, or share the mapping already made
+   * @param [in]: path: sidecar file
+   * @param [in]: height, width, channels: model input shape
+   * @return: the sidecar, nullptr when missing, corrupted or the shape does
+   *          not match the model input
+   */
+  static std::shared_ptr<const NormalizationSidecar> Load(
+      const std::string &path, uint32_t height, uint32_t width,
+      uint32_t channels);
+
+  /**
+   * @brief: sidecar path of a model, the model path with extension replaced
+   */
+  static std::string PathOfModel(const std::string &model_path);
+
+  ~NormalizationSidecar();
+  NormalizationSidecar(const NormalizationSidecar &) = delete;
+  NormalizationSidecar &operator=(const NormalizationSidecar &) = delete;
+
+  // per-pixel BGR interleaved mean
+  const float *mean() const {
+    return mean_;
+  }
+
+  // per-pixel BGR interleaved std
+  const float *std_dev() const {
+    return std_dev_;
+  }
+
+ private:
+  NormalizationSidecar(void *addr, size_t size, const float *mean,
+                       const float *std_dev)
+      : addr_(addr), size_(size), mean_(mean), std_dev_(std_dev) {}
+
+  /**
+   * @brief: map the file and validate it, no sharing
+   */
+  static std::shared_ptr<const NormalizationSidecar> Map(
+      const std::string &path, uint32_t height, uint32_t width,
+      uint32_t channels);
+
+  void *addr_;
+  size_t size_;
+  const float *mean_;
+  const float *std_dev_;
+};
+
+#endif /* NORMALIZATION_SIDECAR_H_ */
@@ -0,0 +1,224 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#include "nv12_converter.h"
+
+#if defined(__aarch64__)
+// vdivq_f32 is only provided by aarch64 neon
+#include <arm_neon.h>
+#define NV12_CONVERTER_NEON
+#endif
+
+namespace {
+// ITU-R BT.601 coefficients in 20 bits fixed point, the same as opencv
+const int32_t kCoefY = 1220542;
+const int32_t kCoefUB = 2116026;
+const int32_t kCoefUG = -409993;
+const int32_t kCoefVG = -852492;
+const int32_t kCoefVR = 1673527;
+const int32_t kCoefShift = 20;
+const int32_t kCoefRound = 1 << (kCoefShift - 1);
+
+// Y starts from 16, U and V are centered at 128
+const int32_t kLumaOffset = 16;
+const int32_t kChromaOffset = 128;
+
+const int32_t kPixelMax = 255;
+
+// BGR channel order of the planes
+const int32_t kBgrChannel = 3;
+const int32_t kBlueIndex = 0;
+const int32_t kGreenIndex = 1;
+const int32_t kRedIndex = 2;
+
+#ifdef NV12_CONVERTER_NEON
+// pixels of one row handled by one neon loop
+const int32_t kNeonPixels = 16;
+#endif
+
+inline int32_t ClampPixel(int32_t value) {
+  return value < 0 ? 0 : (value > kPixelMax ? kPixelMax : value);
+}
+
+/**
+ * @brief: write one pixel into the planes
+ * @param [in]: luma: (Y - 16) * kCoefY
+ * @param [in]: ruv, guv, buv: chroma part of every channel with rounding
+ * @param [in]: index: pixel index in a plane
+ */
+inline void StorePixel(int32_t luma, int32_t ruv, int32_t guv, int32_t buv,
+                       int32_t index, int32_t plane_size, const float *mean,
+                       const float *std_dev, float *planar) {
+  float bgr[kBgrChannel];
+  bgr[kBlueIndex] = ClampPixel((luma + buv) >> kCoefShift);
+  bgr[kGreenIndex] = ClampPixel((luma + guv) >> kCoefShift);
+  bgr[kRedIndex] = ClampPixel((luma + ruv) >> kCoefShift);
+  for (int32_t c = 0; c < kBgrChannel; ++c) {
+    float value = bgr[c];
+    if (mean != nullptr) {
+      value = (value - mean[index * kBgrChannel + c])
+          / std_dev[index * kBgrChannel + c];
+    }
+    planar[c * plane_size + index] = value;
+  }
+}
+
+/**
+ * @brief: convert columns [begin, end) of two rows which share a UV row
+ */
+void ConvertRowPairScalar(const uint8_t *y_row0, const uint8_t *y_row1,
+                          const uint8_t *uv_row, int32_t row, int32_t begin,
+                          int32_t end, int32_t width, int32_t plane_size,
+                          const float *mean, const float *std_dev,
+                          float *planar) {
+  for (int32_t x = begin; x < end; x += 2) {
+    int32_t u = static_cast<int32_t>(uv_row[x]) - kChromaOffset;
+    int32_t v = static_cast<int32_t>(uv_row[x + 1]) - kChromaOffset;
+    int32_t ruv = kCoefRound + kCoefVR * v;
+    int32_t guv = kCoefRound + kCoefVG * v + kCoefUG * u;
+    int32_t buv = kCoefRound + kCoefUB * u;
+
+    const uint8_t *y_rows[] = { y_row0, y_row1 };
+    for (int32_t r = 0; r < 2; ++r) {
+      for (int32_t c = 0; c < 2; ++c) {
+        int32_t luma = static_cast<int32_t>(y_rows[r][x + c]) - kLumaOffset;
+        luma = (luma < 0 ? 0 : luma) * kCoefY;
+        StorePixel(luma, ruv, guv, buv, (row + r) * width + x + c, plane_size,
+                   mean, std_dev, planar);
+      }
+    }
+  }
+}
+
+#ifdef NV12_CONVERTER_NEON
+/**
+ * @brief: fixed point channel of 4 pixels to float, normalized when needed
+ */
+inline float32x4_t ChannelToFloat(int32x4_t luma, int32x4_t chroma) {
+  int32x4_t value = vshrq_n_s32(vaddq_s32(luma, chroma), kCoefShift);
+  value = vminq_s32(vmaxq_s32(value, vdupq_n_s32(0)),
+                    vdupq_n_s32(kPixelMax));
+  return vcvtq_f32_s32(value);
+}
+
+/**
+ * @brief: write 4 pixels of one row into the planes
+ */
+inline void StorePixels4(int32x4_t luma, int32x4_t ruv, int32x4_t guv,
+                         int32x4_t buv, int32_t index, int32_t plane_size,
+                         const float *mean, const float *std_dev, float *planar) {
+  float32x4_t bgr[kBgrChannel];
+  bgr[kBlueIndex] = ChannelToFloat(luma, buv);
+  bgr[kGreenIndex] = ChannelToFloat(luma, guv);
+  bgr[kRedIndex] = ChannelToFloat(luma, ruv);
+  if (mean != nullptr) {
+    float32x4x3_t mean_bgr = vld3q_f32(mean + index * kBgrChannel);
+    float32x4x3_t std_bgr = vld3q_f32(std_dev + index * kBgrChannel);
+    for (int32_t c = 0; c < kBgrChannel; ++c) {
+      bgr[c] = vdivq_f32(vsubq_f32(bgr[c], mean_bgr.val[c]), std_bgr.val[c]);
+    }
+  }
+  for (int32_t c = 0; c < kBgrChannel; ++c) {
+    vst1q_f32(planar + c * plane_size + index, bgr[c]);
+  }
+}
+
+/**
+ * @brief: widen 4 luma values to (Y - 16) * kCoefY
+ */
+inline int32x4_t WidenLuma(uint16x4_t luma) {
+  return vmulq_n_s32(vreinterpretq_s32_u32(vmovl_u16(luma)), kCoefY);
+}
+
+/**
+ * @brief: convert columns [0, end) of two rows which share a UV row,
+ *         end is a multiple of kNeonPixels
+ */
+void ConvertRowPairNeon(const uint8_t *y_row0, const uint8_t *y_row1,
+                        const uint8_t *uv_row, int32_t row, int32_t end,
+                        int32_t width, int32_t plane_size, const float *mean,
+                        const float *std_dev, float *planar) {
+  const uint8x16_t luma_offset = vdupq_n_u8(kLumaOffset);
+  const int16x8_t chroma_offset = vdupq_n_s16(kChromaOffset);
+  const int32x4_t round = vdupq_n_s32(kCoefRound);
+  for (int32_t x = 0; x < end; x += kNeonPixels) {
+    // 8 UV pairs shared by 16 pixels of both rows
+    uint8x8x2_t uv = vld2_u8(uv_row + x);
+    int16x8_t u = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(uv.val[0])),
+                            chroma_offset);
+    int16x8_t v = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(uv.val[1])),
+                            chroma_offset);
+    int32x4_t u_half[2] = { vmovl_s16(vget_low_s16(u)),
+                            vmovl_s16(vget_high_s16(u)) };
+    int32x4_t v_half[2] = { vmovl_s16(vget_low_s16(v)),
+                            vmovl_s16(vget_high_s16(v)) };
+
+    // every chroma value belongs to 2 neighbour pixels
+    int32x4_t ruv[4];
+    int32x4_t guv[4];
+    int32x4_t buv[4];
+    for (int32_t h = 0; h < 2; ++h) {
+      int32x4_t r = vmlaq_n_s32(round, v_half[h], kCoefVR);
+      int32x4_t g = vmlaq_n_s32(vmlaq_n_s32(round, v_half[h], kCoefVG),
+                                u_half[h], kCoefUG);
+      int32x4_t b = vmlaq_n_s32(round, u_half[h], kCoefUB);
+      int32x4x2_t r_dup = vzipq_s32(r, r);
+      int32x4x2_t g_dup = vzipq_s32(g, g);
+      int32x4x2_t b_dup = vzipq_s32(b, b);
+      for (int32_t k = 0; k < 2; ++k) {
+        ruv[h * 2 + k] = r_dup.val[k];
+        guv[h * 2 + k] = g_dup.val[k];
+        buv[h * 2 + k] = b_dup.val[k];
+      }
+    }
+
+    const uint8_t *y_rows[] = { y_row0, y_row1 };
+    for (int32_t r = 0; r < 2; ++r) {
+      // max(0, Y - 16) by saturating subtraction
+      uint8x16_t y = vqsubq_u8(vld1q_u8(y_rows[r] + x), luma_offset);
+      uint16x8_t y_low = vmovl_u8(vget_low_u8(y));
+      uint16x8_t y_high = vmovl_u8(vget_high_u8(y));
+      int32x4_t luma[4] = { WidenLuma(vget_low_u16(y_low)),
+                            WidenLuma(vget_high_u16(y_low)),
+                            WidenLuma(vget_low_u16(y_high)),
+                            WidenLuma(vget_high_u16(y_high)) };
+      int32_t index = (row + r) * width + x;
+      for (int32_t k = 0; k < 4; ++k) {
+        StorePixels4(luma[k], ruv[k], guv[k], buv[k], index + k * 4,
+                     plane_size, mean, std_dev, planar);
+      }
+    }
+  }
+}
+#endif
+}
+
+void Nv12ToPlanarBgr(const uint8_t *nv12, int32_t width, int32_t height,
+                     int32_t stride, const float *mean, const float *std_dev,
+                     float *planar) {
+  int32_t plane_size = width * height;
+  const uint8_t *uv_plane = nv12 + stride * height;
+
+  // columns handled by neon, the rest by scalar code
+  int32_t vector_end = 0;
+#ifdef NV12_CONVERTER_NEON
+  vector_end = width / kNeonPixels * kNeonPixels;
+#endif
+
+  for (int32_t row = 0; row < height; row += 2) {
+    const uint8_t *y_row0 = nv12 + row * stride;
+    const uint8_t *y_row1 = y_row0 + stride;
+    const uint8_t *uv_row = uv_plane + (row / 2) * stride;
+#ifdef NV12_CONVERTER_NEON
+    ConvertRowPairNeon(y_row0, y_row1, uv_row, row, vector_end, width,
+                       plane_size, mean, std_dev, planar);
+#endif
+    ConvertRowPairScalar(y_row0, y_row1, uv_row, row, vector_end, width,
+                         width, plane_size, mean, std_dev, planar);
+  }
+}
@@ -0,0 +1,33 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef NV12_CONVERTER_H_
+#define NV12_CONVERTER_H_
+
+#include <stdint.h>
+
+/**
+ * @brief: convert NV12 image to planar BGR float (B plane, G plane, R plane)
+ *         in one pass, optionally normalized by per-pixel mean and std.
+ *         The result is the same as cvtColor(CV_YUV2BGR_NV12),
+ *         convertTo(CV_32FC3), (x - mean) / std and split, which use the
+ *         ITU-R BT.601 fixed point coefficients of opencv.
+ * @param [in]: nv12: Y plane, UV plane follows at nv12 + stride * height
+ * @param [in]: width: image width, even number
+ * @param [in]: height: image height, even number
+ * @param [in]: stride: bytes of one row in Y and UV plane
+ * @param [in]: mean: BGR interleaved mean of every pixel, nullptr means
+ *              no normalization
+ * @param [in]: std_dev: BGR interleaved std of every pixel, used with mean
+ * @param [out]: planar: 3 * width * height floats
+ */
+void Nv12ToPlanarBgr(const uint8_t *nv12, int32_t width, int32_t height,
+                     int32_t stride, const float *mean, const float *std_dev,
+                     float *planar);
+
+#endif /* NV12_CONVERTER_H_ */
@@ -16,6 +16,7 @@
 #include <string>
 #include <regex>
 #include <cmath>
+#include <cinttypes>
 
 #include "hiaiengine/log.h"
 #include "hiaiengine/data_type_reg.h"
@@ -98,17 +99,66 @@ const float kAttributeFaceDeviation = 0.00001;
 // percent
 const int32_t kScorePercent = 100;
 
+// frame id of the first camera frame
+const uint32_t kInitFrameId = 0;
+
+// most frames waiting for a missing frame, then the missing one is skipped
+const size_t kMaxPendingFrames = 8;
+
+// default longest wait for a missing frame, two frame periods at 5 fps
+const int32_t kDefaultReorderTimeoutMs = 400;
+
+// default most frames waiting to be sent to presenter server
+const int32_t kDefaultSendQueueSize = 4;
+
+// JPEG quality range of the encoder
+const int32_t kJpegQualityMin = 1;
+const int32_t kJpegQualityMax = 100;
+
+// smallest output scale, vpc can reduce at most 1/32
+const float kOutputScaleMin = 0.03125f;
+
+// default JPEG of every frame
+const int32_t kDefaultImageInterval = 1;
+
+// idle JPEG buffers kept besides the ones in the send queue, one is being
+// sent and one is being encoded
+const size_t kJpegPoolSpare = 2;
+
+// JPEGs between two logs of the JPEG pool
+const uint64_t kJpegPoolLogInterval = 1000;
+
+// first JPEG buffer size is the YUV420SP frame size divided by it, a JPEG
+// of a camera frame is far smaller
+const uint32_t kJpegBufferRatio = 2;
+
+// a JPEG which does not fit grows the buffers to its size plus 1/N of it
+const uint32_t kJpegBufferHeadroom = 4;
+
 // IP regular expression
 const std::string kIpRegularExpression =
     "^((25[0-5]|2[0-4]\\d|[1]{1}\\d{1}\\d{1}|[1-9]{1}\\d{1}|\\d{1})($|(?!\\.$)\\.)){4}$";
 
 // channel name regular expression
 const std::string kChannelNameRegularExpression = "[a-zA-Z0-9/]+";
+
+/**
+* @brief: size of a frame downscaled by vpc, even numbers
+*/
+void ScaledSize(uint32_t width, uint32_t height, float scale,
+                uint32_t &scaled_width, uint32_t &scaled_height) {
+  scaled_width = ((static_cast<uint32_t>(width * scale)) >> 1) << 1;
+  scaled_height = ((static_cast<uint32_t>(height * scale)) >> 1) << 1;
+}
 }
 
 biopsy_postprocess::biopsy_postprocess() {
   fd_post_process_config_ = nullptr;
-  presenter_channel_ = nullptr;
+  next_frame_id_ = kInitFrameId;
+  late_frames_ = 0;
+  handled_frames_ = 0;
+  jpeg_encodes_ = 0;
+  jpeg_oversized_ = 0;
 }
 
 /**
@@ -119,9 +169,17 @@ biopsy_postprocess::biopsy_postprocess() {
 HIAI_StatusT biopsy_postprocess::Init(
     const hiai::AIConfig &config,
     const std::vector<hiai::AIModelDescription> &model_desc) {
+    StartupTimer startup_timer("biopsy_postprocess");
     // get configurations
     if (fd_post_process_config_ == nullptr) {
       fd_post_process_config_ = std::make_shared<FaceDetectionPostConfig>();
+      fd_post_process_config_->send_queue_size = kDefaultSendQueueSize;
+      fd_post_process_config_->send_overflow_policy =
+          SendOverflowPolicy::kDropOldest;
+      fd_post_process_config_->image_interval = kDefaultImageInterval;
+      fd_post_process_config_->image_fps = 0;
+      fd_post_process_config_->reorder_timeout_ms = kDefaultReorderTimeoutMs;
+      fd_post_process_config_->skip_image_without_viewer = false;
     }
     // get parameters from graph.config
     for (int index = 0; index < config.items_size(); index++) {
@@ -166,28 +224,209 @@ HIAI_StatusT biopsy_postprocess::Init(
           return HIAI_ERROR;
         }
         ss >> (*fd_post_process_config_).channel_name;
+      } else if (name == "SendQueueSize") {
+        ss >> (*fd_post_process_config_).send_queue_size;
+        if (fd_post_process_config_->send_queue_size <= 0) {
+          HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                          "SendQueueSize=%s which configured is invalid.",
+                          value.c_str());
+          return HIAI_ERROR;
+        }
+      } else if (name == "ImageInterval") {
+        ss >> (*fd_post_process_config_).image_interval;
+        if (fd_post_process_config_->image_interval <= 0) {
+          HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                          "ImageInterval=%s which configured is invalid.",
+                          value.c_str());
+          return HIAI_ERROR;
+        }
+      } else if (name == "ImageFps") {
+        ss >> (*fd_post_process_config_).image_fps;
+        if (fd_post_process_config_->image_fps < 0) {
+          HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                          "ImageFps=%s which configured is invalid.",
+                          value.c_str());
+          return HIAI_ERROR;
+        }
+      } else if (name == "ReorderTimeoutMs") {
+        ss >> (*fd_post_process_config_).reorder_timeout_ms;
+        if (fd_post_process_config_->reorder_timeout_ms < 0) {
+          HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                          "ReorderTimeoutMs=%s which configured is invalid.",
+                          value.c_str());
+          return HIAI_ERROR;
+        }
+      } else if (name == "SkipImageWithoutViewer") {
+        // needs a presenter server which reports its viewers, an older one
+        // always reports 0 and would never get an image
+        fd_post_process_config_->skip_image_without_viewer =
+            (atoi(value.c_str()) != 0);
+      } else if (name == "LivenessCheck") {
+        // the presenter server shows the state of the agent instead of
+        // checking the landmarks itself
+        fd_post_process_config_->liveness.enabled = (atoi(value.c_str()) != 0);
+      } else if (name == "ExtraPresenters") {
+        if (!ParseExtraPresenters(value)) {
+          HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                          "ExtraPresenters=%s which configured is invalid.",
+                          value.c_str());
+          return HIAI_ERROR;
+        }
+      } else if (ParseOutputControl(name, value)) {
+        // adaptive output parameter, handled
+      } else if (name == "SendOverflowPolicy") {
+        if (!PresenterSendQueue::ParsePolicy(
+                value, fd_post_process_config_->send_overflow_policy)) {
+          HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                          "SendOverflowPolicy=%s which configured is invalid.",
+                          value.c_str());
+          return HIAI_ERROR;
+        }
       }
       // else : nothing need to do
     }
-    // call presenter agent, create connection to presenter server
+    const OutputControlConfig &output_control =
+        fd_post_process_config_->output_control;
+    if ((output_control.min_quality > output_control.max_quality)
+        || (output_control.min_quality < kJpegQualityMin)
+        || (output_control.max_quality > kJpegQualityMax)
+        || (output_control.min_scale < kOutputScaleMin)
+        || (output_control.min_scale > 1.0f)
+        || (output_control.target_send_ms <= 0)) {
+      HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                      "adaptive output configured is invalid, quality=[%d, "
+                      "%d], min scale=%f, target send=%d ms",
+                      output_control.min_quality, output_control.max_quality,
+                      output_control.min_scale,
+                      output_control.target_send_ms);
+      return HIAI_ERROR;
+    }
+    output_controller_.reset(new OutputController(output_control));
+    liveness_checker_.reset(
+        new LivenessChecker(fd_post_process_config_->liveness));
+
+    // call presenter agent, create connection to presenter server. JPEG
+    // quality and size follow the link of the first presenter server
     uint16_t u_port = static_cast<uint16_t>(fd_post_process_config_
         ->presenter_port);
-    OpenChannelParam channel_param = { fd_post_process_config_->presenter_ip,
-        u_port, fd_post_process_config_->channel_name, ContentType::kVideo };
-    Channel *chan = nullptr;
-    PresenterErrorCode err_code = OpenChannel(chan, channel_param);
-    // open channel failed
-    if (err_code != PresenterErrorCode::kNone) {
-      HIAI_ENGINE_LOG(HIAI_GRAPH_INIT_FAILED,
-                      "Open presenter channel failed, error code=%d", err_code);
+    PresenterDestination destination = { fd_post_process_config_->presenter_ip,
+        u_port, fd_post_process_config_->channel_name };
+    OutputController *controller = output_controller_.get();
+    if (!AddPresenter(destination,
+        [controller](uint32_t bytes, uint64_t send_us, size_t queue_depth) {
+          controller->OnSent(bytes, send_us, queue_depth);
+        })) {
       return HIAI_ERROR;
     }
-
-    presenter_channel_.reset(chan);
+    // an extra presenter server which is down is skipped, the first one
+    // still gets its frames
+    for (const PresenterDestination &extra :
+         fd_post_process_config_->extra_presenters) {
+      AddPresenter(extra, SendObserver());
+    }
+    startup_timer.Phase("channel open");
+    startup_timer.Finish();
     HIAI_ENGINE_LOG(HIAI_DEBUG_INFO, "End initialize!");
     return HIAI_OK;
 }
 
+bool biopsy_postprocess::ParseOutputControl(const std::string &name,
+                                            const std::string &value) {
+  OutputControlConfig &output_control =
+      fd_post_process_config_->output_control;
+  if (name == "AdaptiveOutput") {
+    output_control.adaptive = (atoi(value.c_str()) != 0);
+  } else if (name == "JpegQualityMax") {
+    output_control.max_quality = atoi(value.c_str());
+  } else if (name == "JpegQualityMin") {
+    output_control.min_quality = atoi(value.c_str());
+  } else if (name == "OutputMinScale") {
+    output_control.min_scale = atof(value.c_str());
+  } else if (name == "TargetSendMs") {
+    output_control.target_send_ms = atoi(value.c_str());
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool biopsy_postprocess::ParseExtraPresenters(const std::string &value) {
+  std::vector<PresenterDestination> &presenters =
+      fd_post_process_config_->extra_presenters;
+  presenters.clear();
+  std::stringstream list(value);
+  std::string item;
+  while (std::getline(list, item, ',')) {
+    size_t port_begin = item.find(':');
+    size_t channel_begin = (port_begin == std::string::npos) ?
+        std::string::npos : item.find(':', port_begin + 1);
+    if (channel_begin == std::string::npos) {
+      return false;
+    }
+    std::string ip = item.substr(0, port_begin);
+    int32_t port = atoi(
+        item.substr(port_begin + 1, channel_begin - port_begin - 1).c_str());
+    std::string channel_name = item.substr(channel_begin + 1);
+    if (IsInValidIp(ip) || IsInValidPort(port)
+        || IsInValidChannelName(channel_name)) {
+      return false;
+    }
+    PresenterDestination destination = { ip, static_cast<uint16_t>(port),
+        channel_name };
+    presenters.push_back(destination);
+  }
+  return true;
+}
+
+bool biopsy_postprocess::AddPresenter(const PresenterDestination &destination,
+                                      const SendObserver &observer) {
+  OpenChannelParam channel_param = { destination.ip, destination.port,
+      destination.channel_name, ContentType::kVideo };
+  Channel *chan = nullptr;
+  PresenterErrorCode err_code = OpenChannel(chan, channel_param);
+  std::string name = destination.ip + ":" + std::to_string(destination.port)
+      + "/" + destination.channel_name;
+  // open channel failed
+  if (err_code != PresenterErrorCode::kNone) {
+    HIAI_ENGINE_LOG(HIAI_GRAPH_INIT_FAILED,
+                    "Open presenter channel %s failed, error code=%d",
+                    name.c_str(), err_code);
+    return false;
+  }
+
+  presenter_channels_.emplace_back(chan);
+  send_queues_.emplace_back(new PresenterSendQueue(
+      chan, name, fd_post_process_config_->send_queue_size,
+      fd_post_process_config_->send_overflow_policy, observer));
+  return true;
+}
+
+bool biopsy_postprocess::IsImageDue() {
+  uint64_t frame_index = handled_frames_++;
+  if (frame_index % fd_post_process_config_->image_interval != 0) {
+    return false;
+  }
+  if (fd_post_process_config_->image_fps <= 0) {
+    return true;
+  }
+
+  // JPEGs are spread evenly, a late frame does not make the next one early
+  std::chrono::steady_clock::time_point now =
+      std::chrono::steady_clock::now();
+  if (now < next_image_time_) {
+    return false;
+  }
+  std::chrono::steady_clock::duration period = std::chrono::duration_cast<
+      std::chrono::steady_clock::duration>(std::chrono::duration<double>(
+          1.0 / fd_post_process_config_->image_fps));
+  next_image_time_ += period;
+  // behind the schedule, the next JPEG is still a full period later
+  if (next_image_time_ < now) {
+    next_image_time_ = now + period;
+  }
+  return true;
+}
+
 bool biopsy_postprocess::IsInValidIp(const std::string &ip) {
   regex re(kIpRegularExpression);
   smatch sm;
@@ -242,7 +481,7 @@ int32_t biopsy_postprocess::SendImage(uint32_t height, uint32_t width,
   image_frame_para.data = data;
   image_frame_para.detection_results = detection_results;
 
-  PresenterErrorCode p_ret = PresentImage(presenter_channel_.get(),
+  PresenterErrorCode p_ret = PresentImage(presenter_channels_.front().get(),
                                             image_frame_para);
   // send to presenter failed
   if (p_ret != PresenterErrorCode::kNone) {
@@ -282,7 +521,47 @@ bool biopsy_postprocess::IsSupportFormat(hiai::IMAGEFORMAT format) {
   return format == hiai::YUV420SP;
 }
 
-HIAI_StatusT biopsy_postprocess::ConvertImage(hiai::ImageData<u_int8_t>& org_img) {
+HIAI_StatusT biopsy_postprocess::DownscaleImage(
+    hiai::ImageData<u_int8_t>& org_img, bool img_aligned, float scale) {
+  // output size (need even number)
+  uint32_t width = 0;
+  uint32_t height = 0;
+  ScaledSize(org_img.width, org_img.height, scale, width, height);
+
+  ascend::utils::DvppBasicVpcPara resize_para;
+  resize_para.src_resolution.width = org_img.width;
+  resize_para.src_resolution.height = org_img.height;
+  resize_para.crop_left = 0;
+  resize_para.crop_up = 0;
+  resize_para.crop_right = ((org_img.width >> 1) << 1) - 1;
+  resize_para.crop_down = ((org_img.height >> 1) << 1) - 1;
+  resize_para.dest_resolution.width = width;
+  resize_para.dest_resolution.height = height;
+  resize_para.is_input_align = img_aligned;
+  // aligned output is what the JPEG encoder takes without copying rows
+  resize_para.is_output_align = true;
+
+  ascend::utils::DvppProcess dvpp_resize_img(resize_para);
+  ascend::utils::DvppVpcOutput dvpp_output;
+  int ret = dvpp_resize_img.DvppBasicVpcProc(org_img.data.get(),
+                                             org_img.size, &dvpp_output);
+  if (ret != ascend::utils::kDvppOperationOk) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "call ez_dvpp failed, failed to downscale image.");
+    return HIAI_ERROR;
+  }
+
+  org_img.data.reset(dvpp_output.buffer, default_delete<u_int8_t[]>());
+  org_img.size = dvpp_output.size;
+  org_img.width = width;
+  org_img.height = height;
+  return HIAI_OK;
+}
+
+HIAI_StatusT biopsy_postprocess::ConvertImage(
+    hiai::ImageData<u_int8_t>& org_img, bool img_aligned,
+    const OutputSetting &setting, std::shared_ptr<uint8_t> &jpeg,
+    uint32_t &jpeg_size) {
   hiai::IMAGEFORMAT format = org_img.format;
   if (!IsSupportFormat(format)){
     HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
@@ -290,6 +569,26 @@ HIAI_StatusT biopsy_postprocess::ConvertImage(hiai::ImageData<u_int8_t>& org_img
     return HIAI_ERROR;
   }
 
+  // a JPEG of a frame is far smaller than the YUV420SP frame, a larger one
+  // gets its own buffer and grows the pool. Without memory for the pool the
+  // image is skipped, the pool is set up again with the next image
+  if ((jpeg_pool_.buffer_size() == 0)
+      && !jpeg_pool_.Init(org_img.size / kJpegBufferRatio,
+                          fd_post_process_config_->send_queue_size
+                              * send_queues_.size() + kJpegPoolSpare)) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "allocate the JPEG buffer pool error, size=%u, skip the "
+                    "image", org_img.size);
+    return HIAI_ERROR;
+  }
+
+  if (setting.scale < 1.0f) {
+    if (DownscaleImage(org_img, img_aligned, setting.scale) != HIAI_OK) {
+      return HIAI_ERROR;
+    }
+    img_aligned = true;
+  }
+
   uint32_t width = org_img.width;
   uint32_t height = org_img.height;
   uint32_t img_size = org_img.size;
@@ -297,16 +596,25 @@ HIAI_StatusT biopsy_postprocess::ConvertImage(hiai::ImageData<u_int8_t>& org_img
   // parameter
   ascend::utils::DvppToJpgPara dvpp_to_jpeg_para;
   dvpp_to_jpeg_para.format = JPGENC_FORMAT_NV12;
-  dvpp_to_jpeg_para.level = 100;//控制质量
+  dvpp_to_jpeg_para.level = setting.quality;//控制质量
   dvpp_to_jpeg_para.resolution.height = height;
   dvpp_to_jpeg_para.resolution.width = width;
+  dvpp_to_jpeg_para.is_align_image = img_aligned;
   ascend::utils::DvppProcess dvpp_to_jpeg(dvpp_to_jpeg_para);
   
 
-  // call DVPP
+  // call DVPP, the JPEG goes straight into a pooled buffer
+  StagingBufferPool::Buffer pooled = jpeg_pool_.Acquire();
+  uint32_t pooled_size = (pooled.get() == nullptr) ? 0 :
+      static_cast<uint32_t>(pooled.size());
   ascend::utils::DvppOutput dvpp_output;
   int32_t ret = dvpp_to_jpeg.DvppOperationProc(reinterpret_cast<char*>(org_img.data.get()),
-                                                img_size, &dvpp_output);
+                                                img_size, pooled.get(),
+                                                pooled_size, &dvpp_output);
+
+  // the largest buffer of the frame is not kept until the JPEG is sent
+  org_img.data.reset();
+  org_img.size = 0;
 
   // failed, no need to send to presenter
   if (ret != 0) {
@@ -315,18 +623,85 @@ HIAI_StatusT biopsy_postprocess::ConvertImage(hiai::ImageData<u_int8_t>& org_img
     return HIAI_ERROR;
   }
 
-  // reset the data in img_vec
-  org_img.data.reset(dvpp_output.buffer, default_delete<uint8_t[]>());
-  org_img.size = dvpp_output.size;
-
+  jpeg_encodes_++;
+  if (dvpp_output.buffer == pooled.get()) {
+    // the buffer goes back to the pool when the send queue is done with it
+    std::shared_ptr<StagingBufferPool::Buffer> holder =
+        make_shared<StagingBufferPool::Buffer>(move(pooled));
+    jpeg = std::shared_ptr<uint8_t>(holder, holder->get());
+  } else {
+    jpeg_oversized_++;
+    jpeg.reset(dvpp_output.buffer, default_delete<uint8_t[]>());
+    // the largest JPEG so far sizes the buffers of the next ones
+    if (dvpp_output.size > jpeg_pool_.buffer_size()) {
+      jpeg_pool_.Resize(dvpp_output.size
+                        + dvpp_output.size / kJpegBufferHeadroom);
+      HIAI_ENGINE_LOG("presenter JPEG buffer grows to %zu bytes, "
+                      "oversized=%" PRIu64, jpeg_pool_.buffer_size(),
+                      jpeg_oversized_);
+    }
+  }
+  jpeg_size = dvpp_output.size;
+  if (jpeg_encodes_ % kJpegPoolLogInterval == 0) {
+    HIAI_ENGINE_LOG("presenter JPEG pool: encodes=%" PRIu64 ", hits=%" PRIu64
+                    ", misses=%" PRIu64 ", oversized=%" PRIu64, jpeg_encodes_,
+                    jpeg_pool_.hits(), jpeg_pool_.misses(), jpeg_oversized_);
+    // the quality changes of the output controller, besides its log of
+    // every single change
+    OutputControlStats output_stats = output_controller_->stats();
+    OutputSetting current = output_controller_->Current();
+    uint64_t kbps = (output_stats.send_us == 0) ? 0 :
+        output_stats.bytes * 8000 / output_stats.send_us;
+    HIAI_ENGINE_LOG("presenter output: quality=%d, scale=%.3f, sends=%" PRIu64
+                    ", link=%" PRIu64 " kbps, degrades=%" PRIu64
+                    ", upgrades=%" PRIu64, current.quality, current.scale,
+                    output_stats.samples, kbps, output_stats.degrades,
+                    output_stats.upgrades);
+  }
   return HIAI_OK;
 }
 
 HIAI_StatusT biopsy_postprocess::HandleResults(
     const std::shared_ptr<FaceRecognitionInfo> &inference_res) {
     HIAI_StatusT status = HIAI_OK;
-    std::vector<FaceImage> face_img_vec = inference_res->face_imgs;
-    ConvertImage(inference_res->org_img);//转换为jpeg格式
+    const std::vector<FaceImage> &face_img_vec = inference_res->face_imgs;
+    // JPEG quality and size follow the throughput of the presenter link,
+    // results are mapped to the JPEG size. Results go every frame, the JPEG
+    // only when it is due, a skipped JPEG saves the DVPP encode as well
+    uint32_t org_width = inference_res->org_img.width;
+    uint32_t org_height = inference_res->org_img.height;
+    OutputSetting setting = output_controller_->Current();
+    uint32_t out_width = org_width;
+    uint32_t out_height = org_height;
+    // without a viewer on any presenter server only the results are sent,
+    // the answer to them tells when a browser starts watching
+    bool has_viewer = false;
+    for (const std::unique_ptr<PresenterSendQueue> &queue : send_queues_) {
+      has_viewer = has_viewer || (queue->viewer_count() > 0);
+    }
+    bool send_image = (!fd_post_process_config_->skip_image_without_viewer
+                       || has_viewer)
+                      && IsImageDue();
+    std::shared_ptr<uint8_t> jpeg;
+    uint32_t jpeg_size = 0;
+    // a JPEG encoded on the device keeps its quality and size
+    bool device_jpeg = (inference_res->org_img.format == hiai::JPEG);
+    if (send_image && device_jpeg) {
+      jpeg = inference_res->org_img.data;
+      jpeg_size = inference_res->org_img.size;
+    } else if (send_image) {
+      send_image = (ConvertImage(inference_res->org_img,
+                                 inference_res->frame.img_aligned, setting,
+                                 jpeg, jpeg_size)
+                    == HIAI_OK);//转换为jpeg格式
+      out_width = inference_res->org_img.width;
+      out_height = inference_res->org_img.height;
+    } else if ((setting.scale < 1.0f) && !device_jpeg) {
+      ScaledSize(org_width, org_height, setting.scale, out_width,
+                 out_height);
+    }
+    float scale_x = static_cast<float>(out_width) / org_width;
+    float scale_y = static_cast<float>(out_height) / org_height;
     /*uint32_t width = inference_res->org_img.width;
     uint32_t height = inference_res->org_img.height;
     uint32_t img_size = inference_res->org_img.size;
@@ -357,42 +732,50 @@ HIAI_StatusT biopsy_postprocess::HandleResults(
     int32_t ret;
     ret = SendImage(height, width, img_size, inference_res->org_img.data.get(), detection_results);	
 	*/
-    // check send result
-    ascend::presenter::proto::PresentImageRequest data;
-    data.set_format(ascend::presenter::proto::ImageFormat::kImageFormatJpeg); 
-    data.set_width(1280);
-    data.set_height(720);
-    unique_ptr<google::protobuf::Message> resp;
-    data.set_data(string((char *)inference_res->org_img.data.get(),
-		inference_res->org_img.size));
-    if(face_img_vec.size() != 0){
-		ascend::presenter::proto::Rectangle_Attr *lxre=nullptr;
-		ascend::presenter::proto::Coordinate *po=nullptr;
-		lxre = data.add_rectangle_list();
-		lxre->mutable_left_top()->set_x(face_img_vec[0].rectangle.lt.x);
-		lxre->mutable_left_top()->set_y(face_img_vec[0].rectangle.lt.y);
-		lxre->mutable_right_bottom()->set_x(face_img_vec[0].rectangle.rb.x);
-		lxre->mutable_right_bottom()->set_y(face_img_vec[0].rectangle.rb.y);   
-		string s="";
-		s = s +  "pitch:" + to_string(inference_res->face_imgs[0].infe_res.head_pose[0]);
-		s = s + ",yaw:" + to_string(inference_res->face_imgs[0].infe_res.head_pose[1]);
-		s = s + ",roll:" + to_string(inference_res->face_imgs[0].infe_res.head_pose[2]);
-		lxre->set_label_text(s);
-		for(int i=0;i<68;i++){
-			po = data.add_point_list();
-			if (face_img_vec[0].infe_res.face_points[i].x<0)
-				face_img_vec[0].infe_res.face_points[i].x = 0;
-			if (face_img_vec[0].infe_res.face_points[i].y<0)
-				face_img_vec[0].infe_res.face_points[i].y = 0;
-			po->set_x(face_img_vec[0].infe_res.face_points[i].x);
-			po->set_y(face_img_vec[0].infe_res.face_points[i].y);
-    	}
-    }    
-    PresenterErrorCode error_code = presenter_channel_->SendMessage(data, resp);
-    //printf("st:%d",error_code);
-	//if (ret == kFdFunFailed) {
-    // status = HIAI_ERROR;
-    //}
+    // sent by the send queue, the engine does not wait for presenter server.
+    // The JPEG is sent from its pooled buffer without any copy.
+    PresenterFrame frame;
+    frame.image.format = ImageFormat::kJpeg;
+    frame.image.width = out_width;
+    frame.image.height = out_height;
+    frame.image.size = 0;
+    frame.image.data = nullptr;
+    if (send_image) {
+      frame.jpeg = move(jpeg);
+      frame.image.size = jpeg_size;
+      frame.image.data = frame.jpeg.get();
+    }
+    // every face goes packed with its landmarks, mapped to the output size
+    frame.image.face_results.resize(face_img_vec.size());
+    for (size_t face = 0; face < face_img_vec.size(); ++face) {
+      const FaceImage &face_img = face_img_vec[face];
+      const InferenceResult &infe_res = face_img.infe_res;
+      FaceResult &one_result = frame.image.face_results[face];
+      one_result.lt.x = face_img.rectangle.lt.x * scale_x;
+      one_result.lt.y = face_img.rectangle.lt.y * scale_y;
+      one_result.rb.x = face_img.rectangle.rb.x * scale_x;
+      one_result.rb.y = face_img.rectangle.rb.y * scale_y;
+      for (int32_t i = 0; i < kHeadPoseNum; i++) {
+        one_result.pose[i] = infe_res.head_pose[i];
+      }
+      one_result.landmarks.resize(kFaceLandmarkNum);
+      for (int32_t i = 0; i < kFaceLandmarkNum; i++) {
+        one_result.landmarks[i].x =
+            max(0, static_cast<int>(infe_res.x[i] * scale_x));
+        one_result.landmarks[i].y =
+            max(0, static_cast<int>(infe_res.y[i] * scale_y));
+      }
+    }
+    frame.image.liveness = liveness_checker_->Update(
+        inference_res->frame.channel_id,
+        face_img_vec.empty() ? nullptr : &face_img_vec[0].infe_res);
+    // every presenter server gets the same JPEG buffer, a copy of the frame
+    // only adds a reference
+    for (size_t i = 1; i < send_queues_.size(); ++i) {
+      PresenterFrame copy = frame;
+      send_queues_[i]->Push(move(copy));
+    }
+    send_queues_.front()->Push(move(frame));
     
 
   // std::vector<NewImageParaT> img_vec = inference_res->imgs;
@@ -484,32 +867,71 @@ HIAI_StatusT biopsy_postprocess::HandleResults(
   return status;
 }
 
+HIAI_StatusT biopsy_postprocess::ReorderFrame(
+    const std::shared_ptr<FaceRecognitionInfo> &inference_res) {
+  std::lock_guard<std::mutex> lock(reorder_mutex_);
+  uint32_t frame_id = inference_res->frame.frame_id;
+  if (frame_id < next_frame_id_) {
+    late_frames_++;
+    HIAI_ENGINE_LOG("frame %u arrived after frame %u, drop it, late=%" PRIu64,
+                    frame_id, next_frame_id_ - 1, late_frames_);
+    return HIAI_OK;
+  }
+  std::chrono::steady_clock::time_point now =
+      std::chrono::steady_clock::now();
+  PendingFrame &pending = pending_frames_[frame_id];
+  pending.info = inference_res;
+  pending.arrival = now;
+
+  HIAI_StatusT status = HIAI_OK;
+  while (!pending_frames_.empty()) {
+    auto first = pending_frames_.begin();
+    // the next frame is still in the biopsy engine, or was discarded by an
+    // engine when its queue was full. wait for it until a frame behind it
+    // waited ReorderTimeoutMs, or too many frames are waiting
+    if (first->first != next_frame_id_) {
+      std::chrono::steady_clock::time_point oldest = now;
+      for (const auto &waiting : pending_frames_) {
+        oldest = std::min(oldest, waiting.second.arrival);
+      }
+      if ((pending_frames_.size() <= kMaxPendingFrames)
+          && (now - oldest < std::chrono::milliseconds(
+              fd_post_process_config_->reorder_timeout_ms))) {
+        break;
+      }
+      HIAI_ENGINE_LOG("frame %u to %u missing, skip them", next_frame_id_,
+                      first->first - 1);
+    }
+
+    std::shared_ptr<FaceRecognitionInfo> frame = first->second.info;
+    next_frame_id_ = first->first + 1;
+    pending_frames_.erase(first);
+    if (HandleResults(frame) != HIAI_OK) {
+      status = HIAI_ERROR;
+    }
+  }
+  return status;
+}
+
 HIAI_IMPL_ENGINE_PROCESS("biopsy_postprocess", biopsy_postprocess,INPUT_SIZE)
 {
-    if (arg0 == nullptr) {
+  // arg0 is from biopsy engine (frames with face),
+  // arg1 is from face detection engine (frames without face)
+  if ((arg0 == nullptr) && (arg1 == nullptr)) {
     HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
                     "Failed to process invalid message.");
     return HIAI_ERROR;
   }
 
-  // check original image is empty or not
-  std::shared_ptr<FaceRecognitionInfo> inference_res = std::static_pointer_cast<
-      FaceRecognitionInfo>(arg0);
-  // if (inference_res->imgs.empty()) {
-  //   HIAI_ENGINE_LOG(
-  //       HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-  //       "Failed to process invalid message, original image is null.");
-  //   return HIAI_ERROR;
-  // }
-
-  // // inference failed, dealing original images
-  // if (!inference_res->status) {
-  //   HIAI_ENGINE_LOG(HIAI_OK, inference_res->msg.c_str());
-  //   HIAI_ENGINE_LOG(HIAI_OK, "will handle original image.");
-  //   return HandleOriginalImage(inference_res);
-  // }
-
-  // // inference success, dealing inference results
-  return HandleResults(inference_res);
-  //return HIAI_OK;
+  // inference success or failed, dealing results in frame order
+  HIAI_StatusT ret = HIAI_OK;
+  if (arg0 != nullptr) {
+    ret = ReorderFrame(std::static_pointer_cast<FaceRecognitionInfo>(arg0));
+  }
+  if ((arg1 != nullptr)
+      && (ReorderFrame(std::static_pointer_cast<FaceRecognitionInfo>(arg1))
+          != HIAI_OK)) {
+    ret = HIAI_ERROR;
+  }
+  return ret;
 }
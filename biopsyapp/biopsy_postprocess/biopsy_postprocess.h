@@ -9,8 +9,13 @@
 #ifndef biopsy_postprocess_ENGINE_H_
 #define biopsy_postprocess_ENGINE_H_
 #include "biopsy_estimate_params.h"
+#include "staging_buffer_pool.h"
+#include "startup_timer.h"
 
+#include <chrono>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
 #include <dirent.h>
 #include <memory>
@@ -27,15 +32,35 @@
 #include "hiaiengine/engine.h"
 #include "ascenddk/presenter/agent/presenter_channel.h"
 #include "presenter_message.pb.h"
-#define INPUT_SIZE 1
+#include "liveness_checker.h"
+#include "output_controller.h"
+#include "presenter_send_queue.h"
+#define INPUT_SIZE 2
 #define OUTPUT_SIZE 1
 
+// presenter server a frame is sent to
+struct PresenterDestination {
+  std::string ip;  // presenter server IP
+  uint16_t port;  // presenter server port for agent
+  std::string channel_name;  // channel name
+};
+
 // face detection configuration
 struct FaceDetectionPostConfig {
   float confidence;  // confidence
   std::string presenter_ip;  // presenter server IP
   int32_t presenter_port;  // presenter server port for agent
   std::string channel_name;  // channel name
+  int32_t send_queue_size;  // most frames waiting to be sent
+  SendOverflowPolicy send_overflow_policy;  // what to drop when queue full
+  OutputControlConfig output_control;  // adaptive JPEG quality and size
+  int32_t image_interval;  // JPEG of every N-th frame, results of every frame
+  float image_fps;  // most JPEGs per second, 0 means no limit
+  bool skip_image_without_viewer;  // no JPEG when no browser is watching
+  int32_t reorder_timeout_ms;  // longest wait for a missing frame
+  LivenessConfig liveness;  // liveness challenge on the device
+  // presenter servers besides the one above, they get the same JPEG
+  std::vector<PresenterDestination> extra_presenters;
 };
 
 class biopsy_postprocess : public hiai::Engine {
@@ -52,12 +77,129 @@ public:
 private:
     bool IsSupportFormat(hiai::IMAGEFORMAT format);
 
-    HIAI_StatusT ConvertImage(hiai::ImageData<u_int8_t>& org_img);
+    /**
+    * @brief: convert YUV420SP to JPEG, downscaled first when the setting
+    *         asks for it. The YUV420SP data is released as soon as it is
+    *         encoded, width and height are the JPEG size after
+    * @param [in]: org_img: YUV420SP image, without data after
+    * @param [in]: img_aligned: original image is aligned or not
+    * @param [in]: setting: JPEG quality and output scale
+    * @param [out]: jpeg: JPEG in a pooled buffer, back to the pool when the
+    *               last reference is gone
+    * @param [out]: jpeg_size: JPEG size
+    * @return: HIAI_StatusT
+    */
+    HIAI_StatusT ConvertImage(hiai::ImageData<u_int8_t>& org_img,
+                              bool img_aligned, const OutputSetting &setting,
+                              std::shared_ptr<uint8_t> &jpeg,
+                              uint32_t &jpeg_size);
+
+    /**
+    * @brief: downscale YUV420SP by vpc, the result is aligned for JPEG
+    * @param [in]: org_img: YUV420SP image, downscaled image after
+    * @param [in]: img_aligned: original image is aligned or not
+    * @param [in]: scale: output size relative to the image
+    * @return: HIAI_StatusT
+    */
+    HIAI_StatusT DownscaleImage(hiai::ImageData<u_int8_t>& org_img,
+                                bool img_aligned, float scale);
+
+    /**
+    * @brief: parse adaptive output parameters in graph.config
+    * @param [in]: name: parameter name
+    * @param [in]: value: parameter value
+    * @return: true: it is an adaptive output parameter, checked in Init
+    */
+    bool ParseOutputControl(const std::string &name,
+                            const std::string &value);
+
+    /**
+    * @brief: parse ExtraPresenters in graph.config,
+    *         format is "ip:port:channel[,ip:port:channel...]"
+    * @param [in]: value: parameter value
+    * @return: true: valid; false: invalid
+    */
+    bool ParseExtraPresenters(const std::string &value);
+
+    /**
+    * @brief: open the channel of a presenter server and start its queue
+    * @param [in]: destination: presenter server and channel
+    * @param [in]: observer: called after every JPEG sent, may be empty
+    * @return: true: success; false: the channel can not be opened
+    */
+    bool AddPresenter(const PresenterDestination &destination,
+                      const SendObserver &observer);
+
+    /**
+    * @brief: the JPEG of this frame is sent or not, by ImageInterval and
+    *         ImageFps. Called once for every frame in frame order
+    * @return: true: convert and send the JPEG; false: send results only
+    */
+    bool IsImageDue();
     // configuration
     std::shared_ptr<FaceDetectionPostConfig> fd_post_process_config_;
 
-    // presenter channel
-    std::shared_ptr<ascend::presenter::Channel> presenter_channel_;
+    // presenter channels, the first is PresenterIp/PresenterPort
+    std::vector<std::shared_ptr<ascend::presenter::Channel>>
+        presenter_channels_;
+
+    // JPEG quality and size of the frames, fed by the send queue
+    std::unique_ptr<OutputController> output_controller_;
+
+    // liveness challenge of every channel, called in frame order
+    std::unique_ptr<LivenessChecker> liveness_checker_;
+
+    // JPEG buffers, sized by the first frame and grown by the largest JPEG.
+    // declared before the send queue so every queued JPEG is gone before
+    // the pool
+    StagingBufferPool jpeg_pool_;
+
+    // JPEGs encoded, and the ones too large for a pooled buffer
+    uint64_t jpeg_encodes_;
+    uint64_t jpeg_oversized_;
+
+    // one queue and sender thread per presenter channel, so a slow server
+    // only drops its own frames. The first one feeds the controller.
+    // declared after the channels, the controller and the JPEG pool so the
+    // queues stop before them
+    std::vector<std::unique_ptr<PresenterSendQueue>> send_queues_;
+
+    /**
+    * @brief: frame waiting for the frames before it
+    */
+    struct PendingFrame {
+      std::shared_ptr<FaceRecognitionInfo> info;
+      std::chrono::steady_clock::time_point arrival;  // put into the buffer
+    };
+
+    // frames arrive from biopsy engine (with face) and face detection engine
+    // (without face), they wait here until the frames before them arrived
+    std::map<uint32_t, PendingFrame> pending_frames_;
+
+    // frame id which should be handled next
+    uint32_t next_frame_id_;
+
+    // frames arrived after a later frame had been handled, they are dropped
+    uint64_t late_frames_;
+
+    // frames from both ports are merged by one engine thread at a time
+    std::mutex reorder_mutex_;
+
+    // frames handled, for ImageInterval
+    uint64_t handled_frames_;
+
+    // earliest time of the next JPEG, for ImageFps
+    std::chrono::steady_clock::time_point next_image_time_;
+
+    /**
+    * @brief: put frame into the reorder buffer and handle all frames which
+    *         are in frame order now. when too many frames are waiting, the
+    *         missing frame is given up
+    * @param [in]: FaceRecognitionInfo format data from either input port
+    * @return: HIAI_StatusT
+    */
+    HIAI_StatusT ReorderFrame(
+        const std::shared_ptr<FaceRecognitionInfo> &inference_res);
 
     /**
     * @brief: handle original image
@@ -0,0 +1,151 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#include "liveness_checker.h"
+
+#include <cmath>
+
+#include "hiaiengine/log.h"
+
+using namespace std;
+using ascend::presenter::LivenessState;
+
+namespace {
+// head pose of a frontal face, every angle below it in degree
+const float kFrontalMaxDegree = 12.0f;
+
+// pitch of the head down in degree
+const float kHeadDownMaxPitch = -20.0f;
+
+// open mouth: inner lip gap against the lip thickness above it, and mouth
+// width against the mouth height below it
+const float kMouthOpenMinGapRatio = 0.7f;
+const float kMouthOpenMaxWidthRatio = 2.0f;
+
+// landmarks of the 68 point model used for the mouth
+const int32_t kUpperLipTop = 51;
+const int32_t kLowerLipBottom = 57;
+const int32_t kMouthInnerLeft = 60;
+const int32_t kUpperLipInner = 62;
+const int32_t kMouthInnerRight = 64;
+const int32_t kLowerLipInner = 66;
+
+float Distance(const InferenceResult &face, int32_t a, int32_t b) {
+  return hypot(face.x[a] - face.x[b], face.y[a] - face.y[b]);
+}
+}
+
+LivenessChecker::LivenessChecker(const LivenessConfig &config)
+    : config_(config), updates_(0), random_(random_device()()) {
+  sessions_.reserve(config_.max_sessions);
+}
+
+LivenessState LivenessChecker::Update(uint32_t channel_id,
+                                      const InferenceResult *face) {
+  if (!config_.enabled) {
+    return LivenessState::kNone;
+  }
+  Session &session = FindSession(channel_id);
+  bool in_result = (session.state == LivenessState::kPassed)
+      || (session.state == LivenessState::kFailed);
+
+  // the face must stay in front of the camera once the challenge began
+  if ((face == nullptr) && (session.state != LivenessState::kFrontal)
+      && !in_result) {
+    MoveTo(channel_id, session, LivenessState::kFailed, false);
+    return session.state;
+  }
+  if (session.pause_frames > 0) {
+    session.pause_frames--;
+    return session.state;
+  }
+
+  session.frames++;
+  if (in_result) {
+    if (session.frames >= config_.result_frames) {
+      MoveTo(channel_id, session, LivenessState::kFrontal, true);
+    }
+    return session.state;
+  }
+
+  if ((face != nullptr) && IsStepMet(session.state, *face)) {
+    session.hits++;
+  }
+  if (session.hits >= config_.step_hits) {
+    if (session.state == LivenessState::kFrontal) {
+      MoveTo(channel_id, session, LivenessState::kMouthOpen, true);
+    } else if (session.state == LivenessState::kMouthOpen) {
+      MoveTo(channel_id, session, LivenessState::kHeadDown, true);
+    } else {
+      MoveTo(channel_id, session, LivenessState::kPassed, false);
+    }
+  } else if (session.frames > config_.step_frames) {
+    MoveTo(channel_id, session, LivenessState::kFailed, false);
+  }
+  return session.state;
+}
+
+LivenessChecker::Session &LivenessChecker::FindSession(uint32_t channel_id) {
+  auto found = sessions_.find(channel_id);
+  if (found == sessions_.end()) {
+    // only a new channel scans the sessions, at most max_sessions
+    if (!sessions_.empty() && (sessions_.size() >= config_.max_sessions)) {
+      auto idlest = sessions_.begin();
+      for (auto it = sessions_.begin(); it != sessions_.end(); ++it) {
+        if (it->second.last_update < idlest->second.last_update) {
+          idlest = it;
+        }
+      }
+      HIAI_ENGINE_LOG("liveness sessions are full, drop channel %u",
+                      idlest->first);
+      sessions_.erase(idlest);
+    }
+    found = sessions_.emplace(channel_id, Session()).first;
+  }
+  found->second.last_update = ++updates_;
+  return found->second;
+}
+
+bool LivenessChecker::IsStepMet(LivenessState state,
+                                const InferenceResult &face) {
+  if (state == LivenessState::kFrontal) {
+    return (fabs(face.head_pose[0]) < kFrontalMaxDegree)
+        && (fabs(face.head_pose[1]) < kFrontalMaxDegree)
+        && (fabs(face.head_pose[2]) < kFrontalMaxDegree);
+  }
+  if (state == LivenessState::kMouthOpen) {
+    float lips = Distance(face, kUpperLipInner, kUpperLipTop)
+        + Distance(face, kLowerLipInner, kLowerLipBottom);
+    float height = Distance(face, kUpperLipTop, kLowerLipBottom);
+    if ((lips <= 0) || (height <= 0)) {
+      return false;
+    }
+    float gap = Distance(face, kUpperLipInner, kLowerLipInner);
+    float width = Distance(face, kMouthInnerLeft, kMouthInnerRight);
+    return (gap / lips > kMouthOpenMinGapRatio)
+        && (width / height < kMouthOpenMaxWidthRatio);
+  }
+  if (state == LivenessState::kHeadDown) {
+    return face.head_pose[0] < kHeadDownMaxPitch;
+  }
+  return false;
+}
+
+void LivenessChecker::MoveTo(uint32_t channel_id, Session &session,
+                             LivenessState state, bool pause) {
+  session.state = state;
+  session.hits = 0;
+  session.frames = 0;
+  // a random pause, so the steps can not be replayed at fixed times
+  session.pause_frames = (pause && (config_.max_pause_frames > 0)) ?
+      static_cast<int32_t>(random_() % config_.max_pause_frames) : 0;
+  if ((state == LivenessState::kPassed) || (state == LivenessState::kFailed)) {
+    HIAI_ENGINE_LOG("liveness of channel %u %s", channel_id,
+                    (state == LivenessState::kPassed) ? "passed" : "failed");
+  }
+}
@@ -0,0 +1,90 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef LIVENESS_CHECKER_H_
+#define LIVENESS_CHECKER_H_
+
+#include <random>
+#include <unordered_map>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "biopsy_estimate_params.h"
+#include "ascenddk/presenter/agent/presenter_types.h"
+
+/**
+ * @brief: liveness challenge parameters in graph.config
+ */
+struct LivenessConfig {
+  bool enabled = false;  // false: the presenter server checks liveness
+  int32_t step_hits = 5;  // frames meeting a step before the next step
+  int32_t step_frames = 500;  // frames a step may take before it fails
+  int32_t result_frames = 25;  // frames a result is kept before a restart
+  int32_t max_pause_frames = 30;  // random pause between steps, [0, N)
+  size_t max_sessions = 64;  // channels checked, the idlest one is dropped
+};
+
+/**
+ * @brief: the liveness challenge of the presenter server on the device. A
+ *         channel passes when its face is frontal, then opens the mouth,
+ *         then moves the head down, each for step_hits frames. A lost face
+ *         during the mouth or head step or a step taking longer than
+ *         step_frames fails. A frame costs a lookup of the channel and a
+ *         few distances of the landmarks, whatever the number of channels.
+ *         Not thread safe, frames are given in frame order by one thread.
+ */
+class LivenessChecker {
+ public:
+  explicit LivenessChecker(const LivenessConfig &config);
+
+  /**
+   * @brief: advance the challenge of a channel by one frame
+   * @param [in]: channel_id: camera channel of the frame
+   * @param [in]: face: first face of the frame, nullptr without a face
+   * @return: state after the frame, kNone when liveness is not checked
+   */
+  ascend::presenter::LivenessState Update(uint32_t channel_id,
+                                          const InferenceResult *face);
+
+ private:
+  /**
+   * @brief: challenge of one channel
+   */
+  struct Session {
+    ascend::presenter::LivenessState state =
+        ascend::presenter::LivenessState::kFrontal;
+    int32_t hits = 0;  // frames meeting the current step
+    int32_t frames = 0;  // frames since the step or the result began
+    int32_t pause_frames = 0;  // frames to ignore before the next step
+    uint64_t last_update = 0;  // for dropping the idlest session
+  };
+
+  /**
+   * @brief: session of a channel, a new one when the channel is new
+   */
+  Session &FindSession(uint32_t channel_id);
+
+  /**
+   * @brief: the face meets the current step or not
+   */
+  static bool IsStepMet(ascend::presenter::LivenessState state,
+                        const InferenceResult &face);
+
+  /**
+   * @brief: go to the next state and log a result
+   */
+  void MoveTo(uint32_t channel_id, Session &session,
+              ascend::presenter::LivenessState state, bool pause);
+
+  LivenessConfig config_;
+  std::unordered_map<uint32_t, Session> sessions_;
+  uint64_t updates_;
+  std::minstd_rand random_;
+};
+
+#endif /* LIVENESS_CHECKER_H_ */
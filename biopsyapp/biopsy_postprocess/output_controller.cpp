@@ -0,0 +1,126 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#include "output_controller.h"
+
+#include <cinttypes>
+
+#include "hiaiengine/log.h"
+
+using namespace std;
+
+namespace {
+// JPEG quality difference of two steps of the ladder
+const int32_t kQualityStep = 10;
+
+// output sizes below full resolution, used down to the configured minimum
+const float kOutputScales[] = { 0.75f, 0.5f, 0.375f, 0.25f };
+
+// weight of a new send time in the moving average
+const float kAverageWeight = 0.2f;
+
+// a backlog of this many frames means the link is too slow
+const size_t kBacklogDepth = 2;
+
+// sends below half of the target in a row before stepping up
+const uint32_t kCalmSendsToUpgrade = 30;
+
+// sends after a change which do not count, the queue still holds frames
+// of the old setting
+const uint32_t kSettleSends = 5;
+
+const uint64_t kMicrosecondsPerMs = 1000;
+}
+
+OutputController::OutputController(const OutputControlConfig &config)
+    : config_(config), level_(0), average_send_us_(0), calm_sends_(0),
+      settle_sends_(0) {
+  OutputSetting setting = { config_.max_quality, 1.0f };
+  ladder_.push_back(setting);
+  if (!config_.adaptive) {
+    return;
+  }
+  for (int32_t quality = config_.max_quality - kQualityStep;
+       quality > config_.min_quality; quality -= kQualityStep) {
+    setting.quality = quality;
+    ladder_.push_back(setting);
+  }
+  setting.quality = config_.min_quality;
+  if (config_.min_quality < config_.max_quality) {
+    ladder_.push_back(setting);
+  }
+  for (float scale : kOutputScales) {
+    if (scale < config_.min_scale) {
+      break;
+    }
+    setting.scale = scale;
+    ladder_.push_back(setting);
+  }
+}
+
+OutputSetting OutputController::Current() const {
+  lock_guard<mutex> lock(mutex_);
+  return ladder_[level_];
+}
+
+void OutputController::OnSent(uint32_t bytes, uint64_t send_us,
+                              size_t queue_depth) {
+  lock_guard<mutex> lock(mutex_);
+  stats_.samples++;
+  stats_.bytes += bytes;
+  stats_.send_us += send_us;
+  if (ladder_.size() == 1) {
+    return;
+  }
+
+  average_send_us_ = (stats_.samples == 1) ? send_us :
+      average_send_us_ + kAverageWeight * (send_us - average_send_us_);
+  if (settle_sends_ > 0) {
+    settle_sends_--;
+    return;
+  }
+
+  float target_us = config_.target_send_ms * kMicrosecondsPerMs;
+  if ((average_send_us_ > target_us) || (queue_depth >= kBacklogDepth)) {
+    calm_sends_ = 0;
+    if (level_ + 1 < ladder_.size()) {
+      stats_.degrades++;
+      MoveTo(level_ + 1);
+    }
+    return;
+  }
+
+  if ((average_send_us_ < target_us / 2) && (queue_depth == 0)) {
+    calm_sends_++;
+  } else {
+    calm_sends_ = 0;
+  }
+  if ((calm_sends_ >= kCalmSendsToUpgrade) && (level_ > 0)) {
+    calm_sends_ = 0;
+    stats_.upgrades++;
+    MoveTo(level_ - 1);
+  }
+}
+
+OutputControlStats OutputController::stats() const {
+  lock_guard<mutex> lock(mutex_);
+  return stats_;
+}
+
+void OutputController::MoveTo(size_t level) {
+  level_ = level;
+  settle_sends_ = kSettleSends;
+  // bytes per microsecond is MB/s, times 8000 is kbit/s
+  uint64_t kbps = (stats_.send_us == 0) ? 0 :
+      stats_.bytes * 8000 / stats_.send_us;
+  HIAI_ENGINE_LOG("presenter output: quality=%d, scale=%.3f, "
+                  "average send=%.0f us, link=%" PRIu64 " kbps, degrades=%"
+                  PRIu64 ", upgrades=%" PRIu64, ladder_[level_].quality,
+                  ladder_[level_].scale, average_send_us_, kbps,
+                  stats_.degrades, stats_.upgrades);
+}
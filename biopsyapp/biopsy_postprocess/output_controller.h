@@ -0,0 +1,94 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef OUTPUT_CONTROLLER_H_
+#define OUTPUT_CONTROLLER_H_
+
+#include <mutex>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief: bounds of the adaptive output in graph.config
+ */
+struct OutputControlConfig {
+  bool adaptive = false;  // false: always max quality and full resolution
+  int32_t max_quality = 100;  // JPEG quality of a fast link, [1, 100]
+  int32_t min_quality = 40;  // lowest JPEG quality before downscaling
+  float min_scale = 0.5f;  // smallest output size relative to the frame
+  int32_t target_send_ms = 40;  // send time of one frame the link should keep
+};
+
+/**
+ * @brief: how the next frame is encoded
+ */
+struct OutputSetting {
+  int32_t quality;  // JPEG quality
+  float scale;  // output size relative to the original frame, (0, 1]
+};
+
+/**
+ * @brief: counters of the controller
+ */
+struct OutputControlStats {
+  uint64_t samples = 0;  // sends observed
+  uint64_t degrades = 0;  // steps to a smaller output
+  uint64_t upgrades = 0;  // steps to a larger output
+  uint64_t bytes = 0;  // JPEG bytes sent
+  uint64_t send_us = 0;  // time spent sending them
+};
+
+/**
+ * @brief: adapts JPEG quality and output resolution to the presenter link.
+ *         The settings form a ladder: full resolution from max quality down
+ *         to min quality, then smaller resolutions at min quality. A slow
+ *         send or a backlog in the send queue steps down, a long run of fast
+ *         sends with an empty queue steps up again.
+ */
+class OutputController {
+ public:
+  explicit OutputController(const OutputControlConfig &config);
+
+  /**
+   * @brief: setting of the next frame, called by the engine thread
+   */
+  OutputSetting Current() const;
+
+  /**
+   * @brief: observe a sent JPEG, called by the sender thread
+   * @param [in]: bytes: JPEG size
+   * @param [in]: send_us: time until presenter server answered
+   * @param [in]: queue_depth: frames still waiting in the send queue
+   */
+  void OnSent(uint32_t bytes, uint64_t send_us, size_t queue_depth);
+
+  /**
+   * @brief: counters of the controller
+   */
+  OutputControlStats stats() const;
+
+ private:
+  /**
+   * @brief: move to another step of the ladder and log it, called with
+   *         mutex_ held
+   */
+  void MoveTo(size_t level);
+
+  OutputControlConfig config_;
+  std::vector<OutputSetting> ladder_;
+
+  mutable std::mutex mutex_;
+  size_t level_;  // current step of ladder_
+  float average_send_us_;  // moving average of the send time
+  uint32_t calm_sends_;  // fast sends in a row with an empty queue
+  uint32_t settle_sends_;  // sends to ignore after a change
+  OutputControlStats stats_;
+};
+
+#endif /* OUTPUT_CONTROLLER_H_ */
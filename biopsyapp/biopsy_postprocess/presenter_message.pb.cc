@@ -57,6 +57,11 @@ class PresentImageResponseDefaultTypeInternal {
   ::google::protobuf::internal::ExplicitlyConstructed<PresentImageResponse>
       _instance;
 } _PresentImageResponse_default_instance_;
+class PresentResultsRequestDefaultTypeInternal {
+ public:
+  ::google::protobuf::internal::ExplicitlyConstructed<PresentResultsRequest>
+      _instance;
+} _PresentResultsRequest_default_instance_;
 }  // namespace proto
 }  // namespace presenter
 }  // namespace ascend
@@ -211,8 +216,31 @@ void InitDefaultsPresentImageResponse() {
   ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsPresentImageResponseImpl);
 }
 
-::google::protobuf::Metadata file_level_metadata[7];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[4];
+void InitDefaultsPresentResultsRequestImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  ::google::protobuf::internal::InitProtobufDefaultsForceUnique();
+#else
+  ::google::protobuf::internal::InitProtobufDefaults();
+#endif  // GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
+  protobuf_presenter_5fmessage_2eproto::InitDefaultsRectangle_Attr();
+  protobuf_presenter_5fmessage_2eproto::InitDefaultsCoordinate();
+  {
+    void* ptr = &::ascend::presenter::proto::_PresentResultsRequest_default_instance_;
+    new (ptr) ::ascend::presenter::proto::PresentResultsRequest();
+    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::ascend::presenter::proto::PresentResultsRequest::InitAsDefaultInstance();
+}
+
+void InitDefaultsPresentResultsRequest() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &InitDefaultsPresentResultsRequestImpl);
+}
+
+::google::protobuf::Metadata file_level_metadata[8];
+const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[5];
 
 const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
@@ -260,6 +288,8 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUT
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageRequest, data_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageRequest, rectangle_list_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageRequest, point_list_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageRequest, face_data_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageRequest, liveness_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -267,6 +297,18 @@ const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUT
   ~0u,  // no _weak_field_map_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageResponse, error_code_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageResponse, error_message_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentImageResponse, viewer_count_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentResultsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentResultsRequest, width_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentResultsRequest, height_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentResultsRequest, rectangle_list_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentResultsRequest, point_list_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentResultsRequest, face_data_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::ascend::presenter::proto::PresentResultsRequest, liveness_),
 };
 static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::ascend::presenter::proto::OpenChannelRequest)},
@@ -275,7 +317,8 @@ static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROT
   { 19, -1, sizeof(::ascend::presenter::proto::Coordinate)},
   { 26, -1, sizeof(::ascend::presenter::proto::Rectangle_Attr)},
   { 34, -1, sizeof(::ascend::presenter::proto::PresentImageRequest)},
-  { 45, -1, sizeof(::ascend::presenter::proto::PresentImageResponse)},
+  { 47, -1, sizeof(::ascend::presenter::proto::PresentImageResponse)},
+  { 55, -1, sizeof(::ascend::presenter::proto::PresentResultsRequest)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -286,6 +329,7 @@ static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&::ascend::presenter::proto::_Rectangle_Attr_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&::ascend::presenter::proto::_PresentImageRequest_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&::ascend::presenter::proto::_PresentImageResponse_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&::ascend::presenter::proto::_PresentResultsRequest_default_instance_),
 };
 
 void protobuf_AssignDescriptors() {
@@ -304,7 +348,7 @@ void protobuf_AssignDescriptorsOnce() {
 void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
 void protobuf_RegisterTypes(const ::std::string&) {
   protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 7);
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 8);
 }
 
 void AddDescriptorsImpl() {
@@ -321,31 +365,43 @@ void AddDescriptorsImpl() {
       "y\030\002 \001(\r\"\224\001\n\016Rectangle_Attr\0224\n\010left_top\030\001"
       " \001(\0132\".ascend.presenter.proto.Coordinate"
       "\0228\n\014right_bottom\030\002 \001(\0132\".ascend.presente"
-      "r.proto.Coordinate\022\022\n\nlabel_text\030\003 \001(\t\"\357"
-      "\001\n\023PresentImageRequest\0223\n\006format\030\001 \001(\0162#"
+      "r.proto.Coordinate\022\022\n\nlabel_text\030\003 \001(\t\"\273"
+      "\002\n\023PresentImageRequest\0223\n\006format\030\001 \001(\0162#"
       ".ascend.presenter.proto.ImageFormat\022\r\n\005w"
       "idth\030\002 \001(\r\022\016\n\006height\030\003 \001(\r\022\014\n\004data\030\004 \001(\014"
       "\022>\n\016rectangle_list\030\005 \003(\0132&.ascend.presen"
       "ter.proto.Rectangle_Attr\0226\n\npoint_list\030\006"
       " \003(\0132\".ascend.presenter.proto.Coordinate"
-      "\"o\n\024PresentImageResponse\022@\n\nerror_code\030\001"
-      " \001(\0162,.ascend.presenter.proto.PresentDat"
-      "aErrorCode\022\025\n\rerror_message\030\002 \001(\t*\245\001\n\024Op"
-      "enChannelErrorCode\022\031\n\025kOpenChannelErrorN"
-      "one\020\000\022\"\n\036kOpenChannelErrorNoSuchChannel\020"
-      "\001\022)\n%kOpenChannelErrorChannelAlreadyOpen"
-      "ed\020\002\022#\n\026kOpenChannelErrorOther\020\377\377\377\377\377\377\377\377\377"
-      "\001*P\n\022ChannelContentType\022\034\n\030kChannelConte"
-      "ntTypeImage\020\000\022\034\n\030kChannelContentTypeVide"
-      "o\020\001*#\n\013ImageFormat\022\024\n\020kImageFormatJpeg\020\000"
-      "*\244\001\n\024PresentDataErrorCode\022\031\n\025kPresentDat"
-      "aErrorNone\020\000\022$\n kPresentDataErrorUnsuppo"
-      "rtedType\020\001\022&\n\"kPresentDataErrorUnsupport"
-      "edFormat\020\002\022#\n\026kPresentDataErrorOther\020\377\377\377"
-      "\377\377\377\377\377\377\001b\006proto3"
+      "\022\021\n\tface_data\030\007 \001(\014\0227\n\010liveness\030\010 \001(\0162%."
+      "ascend.presenter.proto.LivenessState\"\205\001\n"
+      "\024PresentImageResponse\022@\n\nerror_code\030\001 \001("
+      "\0162,.ascend.presenter.proto.PresentDataEr"
+      "rorCode\022\025\n\rerror_message\030\002 \001(\t\022\024\n\014viewer"
+      "_count\030\003 \001(\r\"\372\001\n\025PresentResultsRequest\022\r"
+      "\n\005width\030\002 \001(\r\022\016\n\006height\030\003 \001(\r\022>\n\016rectang"
+      "le_list\030\005 \003(\0132&.ascend.presenter.proto.R"
+      "ectangle_Attr\0226\n\npoint_list\030\006 \003(\0132\".asce"
+      "nd.presenter.proto.Coordinate\022\021\n\tface_da"
+      "ta\030\007 \001(\014\0227\n\010liveness\030\010 \001(\0162%.ascend.pres"
+      "enter.proto.LivenessState*\245\001\n\024OpenChanne"
+      "lErrorCode\022\031\n\025kOpenChannelErrorNone\020\000\022\"\n"
+      "\036kOpenChannelErrorNoSuchChannel\020\001\022)\n%kOp"
+      "enChannelErrorChannelAlreadyOpened\020\002\022#\n\026"
+      "kOpenChannelErrorOther\020\377\377\377\377\377\377\377\377\377\001*P\n\022Cha"
+      "nnelContentType\022\034\n\030kChannelContentTypeIm"
+      "age\020\000\022\034\n\030kChannelContentTypeVideo\020\001*#\n\013I"
+      "mageFormat\022\024\n\020kImageFormatJpeg\020\000*\244\001\n\024Pre"
+      "sentDataErrorCode\022\031\n\025kPresentDataErrorNo"
+      "ne\020\000\022$\n kPresentDataErrorUnsupportedType"
+      "\020\001\022&\n\"kPresentDataErrorUnsupportedFormat"
+      "\020\002\022#\n\026kPresentDataErrorOther\020\377\377\377\377\377\377\377\377\377\001*"
+      "\221\001\n\rLivenessState\022\021\n\rkLivenessNone\020\000\022\024\n\020"
+      "kLivenessFrontal\020\001\022\026\n\022kLivenessMouthOpen"
+      "\020\002\022\025\n\021kLivenessHeadDown\020\003\022\023\n\017kLivenessPa"
+      "ssed\020\004\022\023\n\017kLivenessFailed\020\005b\006proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1295);
+      descriptor, 1795);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "presenter_message.proto", &protobuf_RegisterTypes);
 }
@@ -423,6 +479,24 @@ bool PresentDataErrorCode_IsValid(int value) {
   }
 }
 
+const ::google::protobuf::EnumDescriptor* LivenessState_descriptor() {
+  protobuf_presenter_5fmessage_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_presenter_5fmessage_2eproto::file_level_enum_descriptors[4];
+}
+bool LivenessState_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -1860,6 +1934,8 @@ const int PresentImageRequest::kHeightFieldNumber;
 const int PresentImageRequest::kDataFieldNumber;
 const int PresentImageRequest::kRectangleListFieldNumber;
 const int PresentImageRequest::kPointListFieldNumber;
+const int PresentImageRequest::kFaceDataFieldNumber;
+const int PresentImageRequest::kLivenessFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 PresentImageRequest::PresentImageRequest()
@@ -1881,17 +1957,22 @@ PresentImageRequest::PresentImageRequest(const PresentImageRequest& from)
   if (from.data().size() > 0) {
     data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
   }
+  face_data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.face_data().size() > 0) {
+    face_data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.face_data_);
+  }
   ::memcpy(&format_, &from.format_,
-    static_cast<size_t>(reinterpret_cast<char*>(&height_) -
-    reinterpret_cast<char*>(&format_)) + sizeof(height_));
+    static_cast<size_t>(reinterpret_cast<char*>(&liveness_) -
+    reinterpret_cast<char*>(&format_)) + sizeof(liveness_));
   // @@protoc_insertion_point(copy_constructor:ascend.presenter.proto.PresentImageRequest)
 }
 
 void PresentImageRequest::SharedCtor() {
   data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  face_data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&format_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&format_)) + sizeof(height_));
+      reinterpret_cast<char*>(&liveness_) -
+      reinterpret_cast<char*>(&format_)) + sizeof(liveness_));
   _cached_size_ = 0;
 }
 
@@ -1902,6 +1983,7 @@ PresentImageRequest::~PresentImageRequest() {
 
 void PresentImageRequest::SharedDtor() {
   data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  face_data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 
 void PresentImageRequest::SetCachedSize(int size) const {
@@ -1936,9 +2018,10 @@ void PresentImageRequest::Clear() {
   rectangle_list_.Clear();
   point_list_.Clear();
   data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  face_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&format_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&format_)) + sizeof(height_));
+      reinterpret_cast<char*>(&liveness_) -
+      reinterpret_cast<char*>(&format_)) + sizeof(liveness_));
   _internal_metadata_.Clear();
 }
 
@@ -2029,6 +2112,33 @@ bool PresentImageRequest::MergePartialFromCodedStream(
         break;
       }
 
+      // bytes face_data = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_face_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .ascend.presenter.proto.LivenessState liveness = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_liveness(static_cast< ::ascend::presenter::proto::LivenessState >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -2091,6 +2201,18 @@ void PresentImageRequest::SerializeWithCachedSizes(
       6, this->point_list(static_cast<int>(i)), output);
   }
 
+  // bytes face_data = 7;
+  if (this->face_data().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      7, this->face_data(), output);
+  }
+
+  // .ascend.presenter.proto.LivenessState liveness = 8;
+  if (this->liveness() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      8, this->liveness(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -2144,6 +2266,19 @@ void PresentImageRequest::SerializeWithCachedSizes(
         6, this->point_list(static_cast<int>(i)), deterministic, target);
   }
 
+  // bytes face_data = 7;
+  if (this->face_data().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        7, this->face_data(), target);
+  }
+
+  // .ascend.presenter.proto.LivenessState liveness = 8;
+  if (this->liveness() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      8, this->liveness(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -2190,6 +2325,13 @@ size_t PresentImageRequest::ByteSizeLong() const {
         this->data());
   }
 
+  // bytes face_data = 7;
+  if (this->face_data().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->face_data());
+  }
+
   // .ascend.presenter.proto.ImageFormat format = 1;
   if (this->format() != 0) {
     total_size += 1 +
@@ -2210,6 +2352,12 @@ size_t PresentImageRequest::ByteSizeLong() const {
         this->height());
   }
 
+  // .ascend.presenter.proto.LivenessState liveness = 8;
+  if (this->liveness() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->liveness());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -2245,6 +2393,10 @@ void PresentImageRequest::MergeFrom(const PresentImageRequest& from) {
 
     data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
   }
+  if (from.face_data().size() > 0) {
+
+    face_data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.face_data_);
+  }
   if (from.format() != 0) {
     set_format(from.format());
   }
@@ -2254,6 +2406,9 @@ void PresentImageRequest::MergeFrom(const PresentImageRequest& from) {
   if (from.height() != 0) {
     set_height(from.height());
   }
+  if (from.liveness() != 0) {
+    set_liveness(from.liveness());
+  }
 }
 
 void PresentImageRequest::CopyFrom(const ::google::protobuf::Message& from) {
@@ -2283,9 +2438,11 @@ void PresentImageRequest::InternalSwap(PresentImageRequest* other) {
   rectangle_list_.InternalSwap(&other->rectangle_list_);
   point_list_.InternalSwap(&other->point_list_);
   data_.Swap(&other->data_);
+  face_data_.Swap(&other->face_data_);
   swap(format_, other->format_);
   swap(width_, other->width_);
   swap(height_, other->height_);
+  swap(liveness_, other->liveness_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
@@ -2303,6 +2460,7 @@ void PresentImageResponse::InitAsDefaultInstance() {
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int PresentImageResponse::kErrorCodeFieldNumber;
 const int PresentImageResponse::kErrorMessageFieldNumber;
+const int PresentImageResponse::kViewerCountFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 PresentImageResponse::PresentImageResponse()
@@ -2322,13 +2480,17 @@ PresentImageResponse::PresentImageResponse(const PresentImageResponse& from)
   if (from.error_message().size() > 0) {
     error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
   }
-  error_code_ = from.error_code_;
+  ::memcpy(&error_code_, &from.error_code_,
+    static_cast<size_t>(reinterpret_cast<char*>(&viewer_count_) -
+    reinterpret_cast<char*>(&error_code_)) + sizeof(viewer_count_));
   // @@protoc_insertion_point(copy_constructor:ascend.presenter.proto.PresentImageResponse)
 }
 
 void PresentImageResponse::SharedCtor() {
   error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  error_code_ = 0;
+  ::memset(&error_code_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&viewer_count_) -
+      reinterpret_cast<char*>(&error_code_)) + sizeof(viewer_count_));
   _cached_size_ = 0;
 }
 
@@ -2371,7 +2533,9 @@ void PresentImageResponse::Clear() {
   (void) cached_has_bits;
 
   error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  error_code_ = 0;
+  ::memset(&error_code_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&viewer_count_) -
+      reinterpret_cast<char*>(&error_code_)) + sizeof(viewer_count_));
   _internal_metadata_.Clear();
 }
 
@@ -2416,6 +2580,20 @@ bool PresentImageResponse::MergePartialFromCodedStream(
         break;
       }
 
+      // uint32 viewer_count = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &viewer_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -2458,6 +2636,11 @@ void PresentImageResponse::SerializeWithCachedSizes(
       2, this->error_message(), output);
   }
 
+  // uint32 viewer_count = 3;
+  if (this->viewer_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->viewer_count(), output);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
@@ -2489,6 +2672,11 @@ void PresentImageResponse::SerializeWithCachedSizes(
         2, this->error_message(), target);
   }
 
+  // uint32 viewer_count = 3;
+  if (this->viewer_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->viewer_count(), target);
+  }
+
   if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
@@ -2519,6 +2707,13 @@ size_t PresentImageResponse::ByteSizeLong() const {
       ::google::protobuf::internal::WireFormatLite::EnumSize(this->error_code());
   }
 
+  // uint32 viewer_count = 3;
+  if (this->viewer_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->viewer_count());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -2555,6 +2750,9 @@ void PresentImageResponse::MergeFrom(const PresentImageResponse& from) {
   if (from.error_code() != 0) {
     set_error_code(from.error_code());
   }
+  if (from.viewer_count() != 0) {
+    set_viewer_count(from.viewer_count());
+  }
 }
 
 void PresentImageResponse::CopyFrom(const ::google::protobuf::Message& from) {
@@ -2583,6 +2781,7 @@ void PresentImageResponse::InternalSwap(PresentImageResponse* other) {
   using std::swap;
   error_message_.Swap(&other->error_message_);
   swap(error_code_, other->error_code_);
+  swap(viewer_count_, other->viewer_count_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   swap(_cached_size_, other->_cached_size_);
 }
@@ -2593,6 +2792,453 @@ void PresentImageResponse::InternalSwap(PresentImageResponse* other) {
 }
 
 
+// ===================================================================
+
+void PresentResultsRequest::InitAsDefaultInstance() {
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int PresentResultsRequest::kWidthFieldNumber;
+const int PresentResultsRequest::kHeightFieldNumber;
+const int PresentResultsRequest::kRectangleListFieldNumber;
+const int PresentResultsRequest::kPointListFieldNumber;
+const int PresentResultsRequest::kFaceDataFieldNumber;
+const int PresentResultsRequest::kLivenessFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+PresentResultsRequest::PresentResultsRequest()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    ::protobuf_presenter_5fmessage_2eproto::InitDefaultsPresentResultsRequest();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:ascend.presenter.proto.PresentResultsRequest)
+}
+PresentResultsRequest::PresentResultsRequest(const PresentResultsRequest& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      rectangle_list_(from.rectangle_list_),
+      point_list_(from.point_list_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  face_data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.face_data().size() > 0) {
+    face_data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.face_data_);
+  }
+  ::memcpy(&width_, &from.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&liveness_) -
+    reinterpret_cast<char*>(&width_)) + sizeof(liveness_));
+  // @@protoc_insertion_point(copy_constructor:ascend.presenter.proto.PresentResultsRequest)
+}
+
+void PresentResultsRequest::SharedCtor() {
+  face_data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&liveness_) -
+      reinterpret_cast<char*>(&width_)) + sizeof(liveness_));
+  _cached_size_ = 0;
+}
+
+PresentResultsRequest::~PresentResultsRequest() {
+  // @@protoc_insertion_point(destructor:ascend.presenter.proto.PresentResultsRequest)
+  SharedDtor();
+}
+
+void PresentResultsRequest::SharedDtor() {
+  face_data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+void PresentResultsRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* PresentResultsRequest::descriptor() {
+  ::protobuf_presenter_5fmessage_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_presenter_5fmessage_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+}
+
+const PresentResultsRequest& PresentResultsRequest::default_instance() {
+  ::protobuf_presenter_5fmessage_2eproto::InitDefaultsPresentResultsRequest();
+  return *internal_default_instance();
+}
+
+PresentResultsRequest* PresentResultsRequest::New(::google::protobuf::Arena* arena) const {
+  PresentResultsRequest* n = new PresentResultsRequest;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void PresentResultsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ascend.presenter.proto.PresentResultsRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  rectangle_list_.Clear();
+  point_list_.Clear();
+  face_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&liveness_) -
+      reinterpret_cast<char*>(&width_)) + sizeof(liveness_));
+  _internal_metadata_.Clear();
+}
+
+bool PresentResultsRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:ascend.presenter.proto.PresentResultsRequest)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // uint32 width = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &width_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 height = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &height_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .ascend.presenter.proto.Rectangle_Attr rectangle_list = 5;
+      case 5: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_rectangle_list()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .ascend.presenter.proto.Coordinate point_list = 6;
+      case 6: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(input, add_point_list()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes face_data = 7;
+      case 7: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_face_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .ascend.presenter.proto.LivenessState liveness = 8;
+      case 8: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_liveness(static_cast< ::ascend::presenter::proto::LivenessState >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:ascend.presenter.proto.PresentResultsRequest)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:ascend.presenter.proto.PresentResultsRequest)
+  return false;
+#undef DO_
+}
+
+void PresentResultsRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:ascend.presenter.proto.PresentResultsRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 width = 2;
+  if (this->width() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->width(), output);
+  }
+
+  // uint32 height = 3;
+  if (this->height() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->height(), output);
+  }
+
+  // repeated .ascend.presenter.proto.Rectangle_Attr rectangle_list = 5;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->rectangle_list_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->rectangle_list(static_cast<int>(i)), output);
+  }
+
+  // repeated .ascend.presenter.proto.Coordinate point_list = 6;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->point_list_size()); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, this->point_list(static_cast<int>(i)), output);
+  }
+
+  // bytes face_data = 7;
+  if (this->face_data().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      7, this->face_data(), output);
+  }
+
+  // .ascend.presenter.proto.LivenessState liveness = 8;
+  if (this->liveness() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      8, this->liveness(), output);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  }
+  // @@protoc_insertion_point(serialize_end:ascend.presenter.proto.PresentResultsRequest)
+}
+
+::google::protobuf::uint8* PresentResultsRequest::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic; // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:ascend.presenter.proto.PresentResultsRequest)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 width = 2;
+  if (this->width() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->width(), target);
+  }
+
+  // uint32 height = 3;
+  if (this->height() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->height(), target);
+  }
+
+  // repeated .ascend.presenter.proto.Rectangle_Attr rectangle_list = 5;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->rectangle_list_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        5, this->rectangle_list(static_cast<int>(i)), deterministic, target);
+  }
+
+  // repeated .ascend.presenter.proto.Coordinate point_list = 6;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->point_list_size()); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        6, this->point_list(static_cast<int>(i)), deterministic, target);
+  }
+
+  // bytes face_data = 7;
+  if (this->face_data().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        7, this->face_data(), target);
+  }
+
+  // .ascend.presenter.proto.LivenessState liveness = 8;
+  if (this->liveness() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      8, this->liveness(), target);
+  }
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ascend.presenter.proto.PresentResultsRequest)
+  return target;
+}
+
+size_t PresentResultsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ascend.presenter.proto.PresentResultsRequest)
+  size_t total_size = 0;
+
+  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  }
+  // repeated .ascend.presenter.proto.Rectangle_Attr rectangle_list = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->rectangle_list_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->rectangle_list(static_cast<int>(i)));
+    }
+  }
+
+  // repeated .ascend.presenter.proto.Coordinate point_list = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->point_list_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSize(
+          this->point_list(static_cast<int>(i)));
+    }
+  }
+
+  // bytes face_data = 7;
+  if (this->face_data().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->face_data());
+  }
+
+  // uint32 width = 2;
+  if (this->width() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->width());
+  }
+
+  // uint32 height = 3;
+  if (this->height() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->height());
+  }
+
+  // .ascend.presenter.proto.LivenessState liveness = 8;
+  if (this->liveness() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::EnumSize(this->liveness());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void PresentResultsRequest::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:ascend.presenter.proto.PresentResultsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PresentResultsRequest* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const PresentResultsRequest>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ascend.presenter.proto.PresentResultsRequest)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:ascend.presenter.proto.PresentResultsRequest)
+    MergeFrom(*source);
+  }
+}
+
+void PresentResultsRequest::MergeFrom(const PresentResultsRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:ascend.presenter.proto.PresentResultsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  rectangle_list_.MergeFrom(from.rectangle_list_);
+  point_list_.MergeFrom(from.point_list_);
+  if (from.face_data().size() > 0) {
+
+    face_data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.face_data_);
+  }
+  if (from.width() != 0) {
+    set_width(from.width());
+  }
+  if (from.height() != 0) {
+    set_height(from.height());
+  }
+  if (from.liveness() != 0) {
+    set_liveness(from.liveness());
+  }
+}
+
+void PresentResultsRequest::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:ascend.presenter.proto.PresentResultsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PresentResultsRequest::CopyFrom(const PresentResultsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ascend.presenter.proto.PresentResultsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresentResultsRequest::IsInitialized() const {
+  return true;
+}
+
+void PresentResultsRequest::Swap(PresentResultsRequest* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void PresentResultsRequest::InternalSwap(PresentResultsRequest* other) {
+  using std::swap;
+  rectangle_list_.InternalSwap(&other->rectangle_list_);
+  point_list_.InternalSwap(&other->point_list_);
+  face_data_.Swap(&other->face_data_);
+  swap(width_, other->width_);
+  swap(height_, other->height_);
+  swap(liveness_, other->liveness_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata PresentResultsRequest::GetMetadata() const {
+  protobuf_presenter_5fmessage_2eproto::protobuf_AssignDescriptorsOnce();
+  return ::protobuf_presenter_5fmessage_2eproto::file_level_metadata[kIndexInFileMessages];
+}
+
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace proto
 }  // namespace presenter
@@ -0,0 +1,161 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#include "presenter_send_queue.h"
+
+#include <chrono>
+#include <cinttypes>
+
+#include "hiaiengine/log.h"
+
+using namespace std;
+using namespace ascend::presenter;
+
+namespace {
+// log the counters every N frames sent
+const uint64_t kSendStatsLogInterval = 100;
+
+// overflow policy values in graph.config
+const string kDropOldestPolicy = "drop_oldest";
+const string kDropImagePolicy = "drop_image";
+}
+
+PresenterSendQueue::PresenterSendQueue(Channel *channel, const string &name,
+                                       size_t capacity,
+                                       SendOverflowPolicy policy,
+                                       SendObserver observer)
+    : channel_(channel), name_(name), capacity_(capacity), policy_(policy),
+      observer_(observer), stopping_(false), viewer_count_(0),
+      sender_(&PresenterSendQueue::SendLoop, this) {}
+
+PresenterSendQueue::~PresenterSendQueue() {
+  {
+    lock_guard<mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  ready_.notify_one();
+  sender_.join();
+  LogStats();
+}
+
+void PresenterSendQueue::Push(PresenterFrame &&frame) {
+  {
+    lock_guard<mutex> lock(mutex_);
+    if (frames_.size() >= capacity_) {
+      Overflow();
+    }
+    frames_.push_back(move(frame));
+    stats_.queued++;
+    stats_.max_depth = max<uint64_t>(stats_.max_depth, frames_.size());
+  }
+  ready_.notify_one();
+}
+
+void PresenterSendQueue::Overflow() {
+  if (policy_ == SendOverflowPolicy::kDropImage) {
+    // the oldest frame which still has its JPEG keeps only its results
+    for (PresenterFrame &frame : frames_) {
+      if (frame.image.size > 0) {
+        frame.image.size = 0;
+        frame.image.data = nullptr;
+        frame.jpeg.reset();
+        stats_.images_dropped++;
+        return;
+      }
+    }
+    // queue is full of results only, fall through to drop the oldest
+  }
+  frames_.pop_front();
+  stats_.dropped++;
+}
+
+SendQueueStats PresenterSendQueue::stats() const {
+  lock_guard<mutex> lock(mutex_);
+  return stats_;
+}
+
+bool PresenterSendQueue::ParsePolicy(const string &value,
+                                     SendOverflowPolicy &policy) {
+  if (value == kDropOldestPolicy) {
+    policy = SendOverflowPolicy::kDropOldest;
+    return true;
+  }
+  if (value == kDropImagePolicy) {
+    policy = SendOverflowPolicy::kDropImage;
+    return true;
+  }
+  return false;
+}
+
+void PresenterSendQueue::SendLoop() {
+  while (true) {
+    PresenterFrame frame;
+    size_t queue_depth = 0;
+    {
+      unique_lock<mutex> lock(mutex_);
+      ready_.wait(lock, [this]() {
+        return stopping_ || !frames_.empty();
+      });
+      if (frames_.empty()) {
+        return;
+      }
+      frame = move(frames_.front());
+      frames_.pop_front();
+      queue_depth = frames_.size();
+    }
+
+    // blocks until presenter server answers, the engine is not blocked
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    // a frame without JPEG goes as the lighter results message
+    uint32_t viewer_count = 0;
+    PresenterErrorCode error_code = (frame.image.size > 0) ?
+        PresentImage(channel_, frame.image, viewer_count) :
+        PresentResults(channel_, frame.image, viewer_count);
+    uint64_t send_us = chrono::duration_cast<chrono::microseconds>(
+        chrono::steady_clock::now() - begin).count();
+    if ((error_code == PresenterErrorCode::kNone) && (frame.image.size > 0)
+        && observer_) {
+      observer_(frame.image.size, send_us, queue_depth);
+    }
+    if (error_code == PresenterErrorCode::kNone) {
+      uint32_t last_count = viewer_count_.exchange(viewer_count);
+      if (last_count != viewer_count) {
+        HIAI_ENGINE_LOG("presenter %s viewers changed from %u to %u",
+                        name_.c_str(), last_count, viewer_count);
+      }
+    }
+
+    bool log_stats = false;
+    {
+      lock_guard<mutex> lock(mutex_);
+      if (error_code == PresenterErrorCode::kNone) {
+        stats_.sent++;
+        log_stats = (stats_.sent % kSendStatsLogInterval == 0);
+      } else {
+        stats_.failed++;
+      }
+    }
+    if (error_code != PresenterErrorCode::kNone) {
+      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                      "Send frame to presenter %s failed, error code=%d",
+                      name_.c_str(), error_code);
+    }
+    if (log_stats) {
+      LogStats();
+    }
+  }
+}
+
+void PresenterSendQueue::LogStats() {
+  SendQueueStats snapshot = stats();
+  HIAI_ENGINE_LOG("presenter send queue %s: queued=%" PRIu64 ", sent=%" PRIu64
+                  ", failed=%" PRIu64 ", dropped=%" PRIu64 ", images dropped=%"
+                  PRIu64 ", max depth=%" PRIu64, name_.c_str(), snapshot.queued,
+                  snapshot.sent, snapshot.failed, snapshot.dropped,
+                  snapshot.images_dropped, snapshot.max_depth);
+}
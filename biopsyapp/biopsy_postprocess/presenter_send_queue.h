@@ -0,0 +1,147 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef PRESENTER_SEND_QUEUE_H_
+#define PRESENTER_SEND_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <stdint.h>
+
+#include "ascenddk/presenter/agent/presenter_channel.h"
+
+/**
+ * @brief: what to give up when the send queue is full
+ */
+enum class SendOverflowPolicy {
+  kDropOldest = 0,  // drop the oldest queued frame
+  kDropImage  // drop the JPEG of the oldest queued frame, keep its results
+};
+
+/**
+ * @brief: frame to present, the JPEG is sent from its own buffer. A frame
+ *         with image.size 0 sends only its results
+ */
+struct PresenterFrame {
+  ascend::presenter::ImageFrame image;  // image.data points into jpeg
+  std::shared_ptr<uint8_t> jpeg;  // keeps image.data until it is sent
+};
+
+/**
+ * @brief: counters of the send queue
+ */
+struct SendQueueStats {
+  uint64_t queued = 0;  // frames put into the queue
+  uint64_t sent = 0;  // frames sent and answered by presenter server
+  uint64_t failed = 0;  // frames whose send failed
+  uint64_t dropped = 0;  // frames dropped when the queue was full
+  uint64_t images_dropped = 0;  // JPEGs dropped, results still sent
+  uint64_t max_depth = 0;  // most frames waiting in the queue
+};
+
+/**
+ * @brief: observer of every JPEG sent
+ * @param [in]: bytes: JPEG size
+ * @param [in]: send_us: time until presenter server answered
+ * @param [in]: queue_depth: frames still waiting in the queue
+ */
+typedef std::function<void(uint32_t bytes, uint64_t send_us,
+                           size_t queue_depth)> SendObserver;
+
+/**
+ * @brief: bounded outbound queue of the presenter channel. The engine puts
+ *         a frame and returns at once, a sender thread sends the frames
+ *         in order and waits for the response of presenter server.
+ */
+class PresenterSendQueue {
+ public:
+  /**
+   * @param [in]: channel: presenter channel, only used by the sender thread
+   *              and must live longer than the queue
+   * @param [in]: name: presenter server of the channel, used in logs
+   * @param [in]: capacity: most frames waiting to be sent
+   * @param [in]: policy: what to drop when full
+   * @param [in]: observer: called by the sender thread after every JPEG
+   *              sent successfully, may be empty
+   */
+  PresenterSendQueue(ascend::presenter::Channel *channel,
+                     const std::string &name, size_t capacity,
+                     SendOverflowPolicy policy,
+                     SendObserver observer = SendObserver());
+
+  // send the frames which are already queued, then stop the sender thread
+  ~PresenterSendQueue();
+
+  PresenterSendQueue(const PresenterSendQueue &) = delete;
+  PresenterSendQueue &operator=(const PresenterSendQueue &) = delete;
+
+  /**
+   * @brief: queue a frame, apply the overflow policy when full
+   * @param [in]: frame: frame to send
+   */
+  void Push(PresenterFrame &&frame);
+
+  /**
+   * @brief: counters of the queue
+   */
+  SendQueueStats stats() const;
+
+  /**
+   * @brief: browsers watching the channel in the last answer of presenter
+   *         server, 0 before the first answer
+   */
+  uint32_t viewer_count() const {
+    return viewer_count_.load();
+  }
+
+  /**
+   * @brief: parse the overflow policy in graph.config
+   * @param [in]: value: "drop_oldest" or "drop_image"
+   * @param [out]: policy: parsed policy
+   * @return: true: valid; false: invalid
+   */
+  static bool ParsePolicy(const std::string &value,
+                          SendOverflowPolicy &policy);
+
+ private:
+  void SendLoop();
+
+  /**
+   * @brief: make room for one frame by the overflow policy, called with
+   *         mutex_ held
+   */
+  void Overflow();
+
+  void LogStats();
+
+  ascend::presenter::Channel *channel_;
+  std::string name_;
+  size_t capacity_;
+  SendOverflowPolicy policy_;
+  SendObserver observer_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<PresenterFrame> frames_;
+  bool stopping_;
+  SendQueueStats stats_;
+
+  // written by the sender thread, read by the engine
+  std::atomic<uint32_t> viewer_count_;
+
+  // started last, after every member it uses
+  std::thread sender_;
+};
+
+#endif /* PRESENTER_SEND_QUEUE_H_ */
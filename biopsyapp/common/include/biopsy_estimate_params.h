@@ -26,6 +26,13 @@ const string kModelPathParamKey = "model_path";
 // batch size parameter key in graph.config
 const string kBatchSizeParamKey = "batch_size";
 
+// warm-up times parameter key in graph.config, 0 means no warm-up
+const string kWarmUpTimesParamKey = "warm_up_times";
+
+// synthetic frame used by warm-up, same as the camera resolution
+const uint32_t kWarmUpFrameWidth = 1280;
+const uint32_t kWarmUpFrameHeight = 720;
+
 /**
  * @brief: face recognition APP error code definition
  */
@@ -90,6 +97,58 @@ void serialize(Archive& ar, ErrorInfo& data) {
   ar(data.err_code, data.err_msg);
 }
 
+/**
+ * @brief: detection region of interest in original image pixels
+ *         right/down are inclusive, an empty region means the full frame
+ */
+struct DetectionRoi {
+  uint32_t left = 0;  // x-axis of upper left corner
+  uint32_t up = 0;  // y-axis of upper left corner
+  uint32_t right = 0;  // x-axis of lower right corner
+  uint32_t down = 0;  // y-axis of lower right corner
+};
+
+/**
+ * @brief: serialize for DetectionRoi
+ *         engine uses it to transfer data between host and device
+ */
+template<class Archive>
+void serialize(Archive& ar, DetectionRoi& data) {
+  ar(data.left, data.up, data.right, data.down);
+}
+
+/**
+ * @brief: clip a crop area to the image and align it for vpc,
+ *         left/up need even number, right/down need odd number
+ * @param [in]: width: image width
+ * @param [in]: height: image height
+ * @param [out]: area: crop area, right/down are inclusive
+ * @return: false when the area is empty or out of image
+ */
+inline bool AlignCropArea(uint32_t width, uint32_t height,
+                          DetectionRoi &area) {
+  if ((width < 2) || (height < 2)) {
+    return false;
+  }
+
+  // right-bottom point of the full image (odd number)
+  uint32_t max_right = ((width >> 1) << 1) - 1;
+  uint32_t max_down = ((height >> 1) << 1) - 1;
+
+  area.left = (area.left >> 1) << 1;
+  area.up = (area.up >> 1) << 1;
+  area.right = (area.right > max_right) ? max_right : area.right;
+  area.down = (area.down > max_down) ? max_down : area.down;
+  if ((area.right <= area.left) || (area.down <= area.up)) {
+    return false;
+  }
+
+  // right-bottom point need odd number, it is still greater than left-top
+  area.right = ((area.right & 1) == 0) ? (area.right - 1) : area.right;
+  area.down = ((area.down & 1) == 0) ? (area.down - 1) : area.down;
+  return true;
+}
+
 /**
  * @brief: face rectangle
  */
@@ -129,13 +188,31 @@ void serialize(Archive& ar, FaceFeature& data) {
      data.right_mouth);
 }
 
+// landmark points of a face
+const int kFaceLandmarkNum = 68;
+
+// pitch, yaw and roll of a head
+const int kHeadPoseNum = 3;
+
 /**
- * @brief: face image inference result
+ * @brief: face image inference result, structure of arrays in the original
+ *         image coordinate, so it is decoded and consumed without
+ *         conversion
  */
- struct InferenceResult {
-   hiai::Point2D face_points[68];
-   float head_pose[3];
+struct InferenceResult {
+  float x[kFaceLandmarkNum];  // x of every landmark
+  float y[kFaceLandmarkNum];  // y of every landmark
+  float head_pose[kHeadPoseNum];  // pitch, yaw, roll in degree
 };
+
+/**
+ * @brief: serialize for InferenceResult
+ *         engine uses it to transfer data between host and device
+ */
+template<class Archive>
+void serialize(Archive& ar, InferenceResult& data) {
+  ar(data.x, data.y, data.head_pose);
+}
 /**
  * @brief: face image
  */
@@ -154,7 +231,8 @@ struct FaceImage {
  */
 template<class Archive>
 void serialize(Archive& ar, FaceImage& data) {
-  ar(data.image, data.rectangle, data.feature_mask, data.feature_vector);
+  ar(data.image, data.rectangle, data.feature_mask, data.feature_vector,
+     data.infe_res);
 }
 
 /**
@@ -164,6 +242,8 @@ struct FaceRecognitionInfo {
   FrameInfo frame;  // frame information
   ErrorInfo err_info;  // error information
   hiai::ImageData<u_int8_t> org_img;  // original image
+  // down-scaled copies of org_img, level i is 1/2^(i+1) of the original
+  std::vector<hiai::ImageData<u_int8_t>> pyramid;
   std::vector<FaceImage> face_imgs;  // cropped image
   int faces_size = -1;
   int presize = -1;
@@ -175,7 +255,7 @@ struct FaceRecognitionInfo {
  */
 template<class Archive>
 void serialize(Archive& ar, FaceRecognitionInfo& data) {
-  ar(data.frame, data.err_info, data.org_img, data.face_imgs);
+  ar(data.frame, data.err_info, data.org_img, data.pyramid, data.face_imgs);
 }
 
 #endif /* FACE_RECOGNITION_PARAMS_H_ */
@@ -0,0 +1,101 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef DEVICE_JPEG_ENCODER_H_
+#define DEVICE_JPEG_ENCODER_H_
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <stdint.h>
+
+#include "hiaiengine/data_type.h"
+#include "hiaiengine/log.h"
+#include "ascenddk/ascend_ezdvpp/dvpp_process.h"
+#include "biopsy_estimate_params.h"
+
+// JPEG quality of the original image encoded on the device, in graph.config.
+// 0 sends the YUV420SP image and the host encodes it with adaptive quality.
+// Above 0 the device encodes every frame at this fixed quality and full size,
+// before the host decides anything. This disables the adaptive output
+// controller of biopsy_postprocess, and ImageInterval, ImageFps and
+// SkipImageWithoutViewer only choose which JPEG the host sends, they save
+// neither the encoding nor the transfer to the host
+const std::string kDeviceJpegQualityParamKey = "device_jpeg_quality";
+
+// valid device JPEG quality range, 0 means off
+const int32_t kDeviceJpegQualityMin = 0;
+const int32_t kDeviceJpegQualityMax = 100;
+
+/**
+ * @brief: parse device_jpeg_quality in graph.config
+ * @param [in]: value: parameter value
+ * @param [out]: quality: parsed quality
+ * @return: true: valid; false: invalid
+ */
+inline bool ParseDeviceJpegQuality(const std::string &value,
+                                   int32_t &quality) {
+  std::stringstream ss(value);
+  ss >> quality;
+  if (ss.fail() || (quality < kDeviceJpegQualityMin)
+      || (quality > kDeviceJpegQualityMax)) {
+    return false;
+  }
+  if (quality > kDeviceJpegQualityMin) {
+    HIAI_ENGINE_LOG("device_jpeg_quality=%d, every frame is encoded on the "
+                    "device, the adaptive output controller and the image "
+                    "rate limits of the host are disabled", quality);
+  }
+  return true;
+}
+
+/**
+ * @brief: replace the YUV420SP original image by its JPEG before the frame
+ *         crosses to the host, which then sends the JPEG as it is. The
+ *         pyramid is dropped as well, the host uses neither of them.
+ *         A frame whose encoding failed is sent unchanged
+ * @param [in]: quality: JPEG quality, 0 does nothing
+ * @param [in]: info: frame to send, its org_img is the JPEG after
+ * @return: true: org_img is a JPEG now; false: unchanged
+ */
+inline bool EncodeOriginalImage(int32_t quality, FaceRecognitionInfo &info) {
+  hiai::ImageData<u_int8_t> &org_img = info.org_img;
+  if ((quality <= kDeviceJpegQualityMin) || (org_img.format != hiai::YUV420SP)
+      || (org_img.data == nullptr)) {
+    return false;
+  }
+
+  ascend::utils::DvppToJpgPara dvpp_to_jpeg_para;
+  dvpp_to_jpeg_para.format =
+      (info.frame.org_img_format == INPUT_YUV420_SEMI_PLANNER_VU) ?
+          JPGENC_FORMAT_NV21 : JPGENC_FORMAT_NV12;
+  dvpp_to_jpeg_para.level = quality;
+  dvpp_to_jpeg_para.resolution.width = org_img.width;
+  dvpp_to_jpeg_para.resolution.height = org_img.height;
+  dvpp_to_jpeg_para.is_align_image = info.frame.img_aligned;
+  ascend::utils::DvppProcess dvpp_to_jpeg(dvpp_to_jpeg_para);
+
+  ascend::utils::DvppOutput dvpp_output;
+  int ret = dvpp_to_jpeg.DvppOperationProc(
+      reinterpret_cast<char *>(org_img.data.get()), org_img.size,
+      &dvpp_output);
+  if (ret != ascend::utils::kDvppOperationOk) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "Failed to convert YUV420SP to JPEG on the device, "
+                    "send YUV420SP, frame_id=%u", info.frame.frame_id);
+    return false;
+  }
+
+  org_img.data.reset(dvpp_output.buffer, std::default_delete<u_int8_t[]>());
+  org_img.size = dvpp_output.size;
+  org_img.format = hiai::JPEG;
+  info.pyramid.clear();
+  return true;
+}
+
+#endif /* DEVICE_JPEG_ENCODER_H_ */
@@ -0,0 +1,443 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef INFERENCE_STAGE_H_
+#define INFERENCE_STAGE_H_
+
+#include <chrono>
+#include <cinttypes>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hiaiengine/ai_model_manager.h"
+#include "hiaiengine/ai_tensor.h"
+#include "hiaiengine/ai_types.h"
+#include "hiaiengine/engine.h"
+#include "hiaiengine/log.h"
+#include "biopsy_estimate_params.h"
+#include "staging_buffer_pool.h"
+#include "worker_pool.h"
+
+// AI model process timeout, 0 means synchronous call
+const uint32_t kStageProcessTimeout = 0;
+
+// log the stage timing every N model executions
+const uint64_t kStageStatsLogInterval = 100;
+
+// most idle staging buffers kept by one stage
+const size_t kStagingBufferPoolSize = 4;
+
+// pixel value of the warm-up frame
+const int kWarmUpFrameGray = 128;
+
+/**
+ * @brief: align value up to a multiple of align, usable for tensor shapes
+ */
+constexpr uint32_t AlignUp(uint32_t value, uint32_t align) {
+  return (value + align - 1) / align * align;
+}
+
+/**
+ * @brief: result of one InferenceStage run
+ */
+enum class StageResult {
+  kOk = 0,
+  kPreProcessFailed,
+  kInferenceFailed,
+  kPostProcessFailed
+};
+
+/**
+ * @brief: accumulated timing of one InferenceStage (unit: microseconds)
+ */
+struct StageStats {
+  uint64_t runs = 0;  // model executions
+  uint64_t items = 0;  // valid items, padding slots are not counted
+  uint64_t pre_process_us = 0;
+  uint64_t inference_us = 0;
+  uint64_t post_process_us = 0;
+};
+
+/**
+ * @brief: send FaceRecognitionInfo to next engine
+ * @param [in]: engine: sender engine
+ * @param [in]: port: output port
+ * @param [in]: message: data to send
+ * @param [in]: retry: retry until sent when the queue is full, otherwise
+ *              sleep once and give up
+ * @param [in]: interval: sleep interval when queue full (unit:microseconds)
+ * @return: HIAI_StatusT of the last SendData
+ */
+inline HIAI_StatusT SendDataWithRetry(
+    hiai::Engine *engine, uint32_t port,
+    const std::shared_ptr<FaceRecognitionInfo> &message, bool retry,
+    useconds_t interval) {
+  HIAI_StatusT ret = HIAI_OK;
+  do {
+    ret = engine->SendData(port, "FaceRecognitionInfo",
+                           std::static_pointer_cast<void>(message));
+    // when queue full, sleep
+    if (ret == HIAI_QUEUE_FULL) {
+      HIAI_ENGINE_LOG("queue full, sleep %u us", interval);
+      usleep(interval);
+    }
+  } while (ret == HIAI_QUEUE_FULL && retry);
+
+  if (ret != HIAI_OK) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "call SendData failed, err_code=%d", ret);
+  }
+  return ret;
+}
+
+/**
+ * @brief: create a gray NV12 frame of the camera resolution, engines run it
+ *         through their real process path to warm up before the first frame
+ * @return: synthetic frame, nullptr when out of memory
+ */
+inline std::shared_ptr<FaceRecognitionInfo> CreateWarmUpFrame() {
+  uint32_t img_size = kWarmUpFrameWidth * kWarmUpFrameHeight
+      * kNv12SizeMolecule / kNv12SizeDenominator;
+  u_int8_t *img_buffer = new (std::nothrow) u_int8_t[img_size];
+  if (img_buffer == nullptr) {
+    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                    "new the warm-up frame error, size=%u", img_size);
+    return nullptr;
+  }
+  // luma and chroma are both the middle value, a plain gray image
+  memset(img_buffer, kWarmUpFrameGray, img_size);
+
+  std::shared_ptr<FaceRecognitionInfo> frame =
+      std::make_shared<FaceRecognitionInfo>();
+  frame->org_img.width = kWarmUpFrameWidth;
+  frame->org_img.height = kWarmUpFrameHeight;
+  frame->org_img.size = img_size;
+  frame->org_img.data.reset(img_buffer, std::default_delete<u_int8_t[]>());
+  return frame;
+}
+
+/**
+ * @brief: model execution shared by the inference engines.
+ *         It owns the model manager, a pool of input staging buffers and
+ *         the output tensors, runs the items by batch and records the
+ *         timing. Pre-process of concurrent runs uses separate buffers, only
+ *         the model execution and post-process are serialized. The slots of
+ *         a batch are pre-processed and post-processed in parallel on the
+ *         shared WorkerPool, so both policies must only touch the data of
+ *         their own item. A model only plugs in its pre-process and
+ *         post-process policy:
+ *
+ *         PreProcessor::Context: per invocation data of the engine
+ *         PreProcessor::kItemSize: input bytes of one batch item, Init can
+ *             override it when the model input is chosen by configuration
+ *         PreProcessor::PreProcess(Context&, int32_t index, uint8_t *slot):
+ *             write item index into slot (item_size() bytes)
+ *         PostProcessor::PostProcess(Context&, int32_t index, int32_t slot,
+ *             const std::vector<std::shared_ptr<hiai::IAITensor>>&):
+ *             decode the slot-th result of the batch output to item index
+ */
+template<class PreProcessor, class PostProcessor>
+class InferenceStage {
+ public:
+  typedef typename PreProcessor::Context Context;
+
+  InferenceStage()
+      : batch_size_(1), warm_up_times_(1), item_size_(PreProcessor::kItemSize) {}
+  ~InferenceStage() = default;
+
+  /**
+   * @brief: parse model_path, batch_size and warm_up_times, load the model
+   *         and size the staging buffers from the model input tensor, start
+   *         the shared worker pool when it is configured
+   * @param [in]: config: configuration in graph.config
+   * @param [in]: item_size: input bytes of one batch item
+   * @return: true: success; false: failed
+   */
+  bool Init(const hiai::AIConfig &config,
+            uint32_t item_size = PreProcessor::kItemSize) {
+    item_size_ = item_size;
+    hiai::AIModelDescription model_desc;
+    for (int index = 0; index < config.items_size(); ++index) {
+      const hiai::AIConfigItem &item = config.items(index);
+      if (item.name() == kModelPathParamKey) {
+        model_desc.set_path(item.value().data());
+        model_name_ = GetModelName(item.value());
+        model_desc.set_name(model_name_);
+      } else if (item.name() == kBatchSizeParamKey) {
+        std::stringstream ss(item.value());
+        ss >> batch_size_;
+      } else if (item.name() == kWarmUpTimesParamKey) {
+        std::stringstream ss(item.value());
+        ss >> warm_up_times_;
+      }
+    }
+
+    if (batch_size_ <= 0) {
+      HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                      "batch_size=%d which configured is invalid.",
+                      batch_size_);
+      return false;
+    }
+
+    if (warm_up_times_ < 0) {
+      HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                      "warm_up_times=%d which configured is invalid.",
+                      warm_up_times_);
+      return false;
+    }
+    StartWorkerPool(config);
+
+    ai_model_manager_ = std::make_shared<hiai::AIModelManager>();
+    std::vector<hiai::AIModelDescription> model_desc_vec;
+    model_desc_vec.push_back(model_desc);
+    hiai::AIStatus ret = ai_model_manager_->Init(config, model_desc_vec);
+    if (ret != hiai::SUCCESS) {
+      HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE, "initialize AI model failed");
+      return false;
+    }
+
+    uint32_t buffer_size = batch_size_ * item_size_;
+    if (!CheckInputSize(buffer_size)) {
+      return false;
+    }
+    if (!pool_.Init(buffer_size, kStagingBufferPoolSize)) {
+      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                      "allocate the tensor buffer error, size=%u",
+                      buffer_size);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief: batch size of the model
+   */
+  int32_t batch_size() const {
+    return batch_size_;
+  }
+
+  /**
+   * @brief: input bytes of one batch item
+   */
+  uint32_t item_size() const {
+    return item_size_;
+  }
+
+  /**
+   * @brief: times of warm-up run, 0 means no warm-up
+   */
+  int32_t warm_up_times() const {
+    return warm_up_times_;
+  }
+
+  /**
+   * @brief: accumulated timing
+   */
+  StageStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  /**
+   * @brief: run items [0, item_num) of the context through the model
+   *         by batch, item start + slot is written into and decoded from
+   *         the slot-th position of its batch
+   * @param [in]: context: per invocation data of the engine
+   * @param [in]: item_num: number of items
+   * @return: StageResult
+   */
+  StageResult Run(Context &context, int32_t item_num) {
+    for (int32_t start = 0; start < item_num; start += batch_size_) {
+      int32_t valid_num = item_num - start;
+      valid_num = (valid_num > batch_size_) ? batch_size_ : valid_num;
+      Clock::time_point pre_begin = Clock::now();
+
+      // returned to the pool when leaving the scope, also on failure
+      StagingBufferPool::Buffer buffer = pool_.Acquire();
+      if (buffer.get() == nullptr) {
+        HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                        "allocate the tensor buffer error, size=%u",
+                        pool_.buffer_size());
+        return StageResult::kPreProcessFailed;
+      }
+
+      // padding slots of the last batch are not written, they keep the data
+      // of an earlier batch (or zero) and their results are not decoded
+      uint8_t *batch_buffer = buffer.get();
+      bool pre_ok = WorkerPool::Instance().ParallelFor(
+          valid_num, [&](int32_t slot) {
+            return PreProcessor::PreProcess(context, start + slot,
+                                            batch_buffer + slot * item_size_);
+          });
+      if (!pre_ok) {
+        return StageResult::kPreProcessFailed;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      Clock::time_point inference_begin = Clock::now();
+      if (!Execute(buffer.get())) {
+        return StageResult::kInferenceFailed;
+      }
+      Clock::time_point post_begin = Clock::now();
+
+      bool post_ok = WorkerPool::Instance().ParallelFor(
+          valid_num, [&](int32_t slot) {
+            return PostProcessor::PostProcess(context, start + slot, slot,
+                                              output_tensors_);
+          });
+      if (!post_ok) {
+        return StageResult::kPostProcessFailed;
+      }
+      RecordStats(valid_num, pre_begin, inference_begin, post_begin,
+                  Clock::now());
+    }
+    return StageResult::kOk;
+  }
+
+  /**
+   * @brief: drop the accumulated timing, warm-up runs call it so they are
+   *         not counted
+   */
+  void ResetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_ = StageStats();
+  }
+
+ private:
+  typedef std::chrono::steady_clock Clock;
+
+  /**
+   * @brief: model name is the file name of the model without extension
+   */
+  static std::string GetModelName(const std::string &model_path) {
+    std::string::size_type begin = model_path.find_last_of('/');
+    begin = (begin == std::string::npos) ? 0 : begin + 1;
+    std::string::size_type end = model_path.find_last_of('.');
+    end = (end == std::string::npos || end < begin) ? model_path.size() : end;
+    return model_path.substr(begin, end - begin);
+  }
+
+  /**
+   * @brief: compare the input size of the loaded model with the size which
+   *         the pre-process writes
+   * @param [in]: buffer_size: batch_size * item_size
+   * @return: true: match or unknown; false: mismatch
+   */
+  bool CheckInputSize(uint32_t buffer_size) {
+    std::vector<hiai::TensorDimension> input_dims;
+    std::vector<hiai::TensorDimension> output_dims;
+    hiai::AIStatus ret = ai_model_manager_->GetModelIOTensorDim(
+        model_name_, input_dims, output_dims);
+    if ((ret != hiai::SUCCESS) || input_dims.empty()) {
+      HIAI_ENGINE_LOG("model %s input size unknown, use %u",
+                      model_name_.c_str(), buffer_size);
+      return true;
+    }
+    if (input_dims[0].size != buffer_size) {
+      HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                      "model %s input size is %u, but batch_size=%d needs %u",
+                      model_name_.c_str(), input_dims[0].size, batch_size_,
+                      buffer_size);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief: execute the model on a staging buffer, the input and output
+   *         tensors are created once and reused by every batch
+   * @param [in]: buffer: staging buffer of the batch
+   * @return: true: success; false: failed
+   */
+  bool Execute(uint8_t *buffer) {
+    if (input_buffer_ == nullptr) {
+      input_buffer_ = std::make_shared<hiai::AINeuralNetworkBuffer>();
+      input_tensors_.push_back(
+          std::static_pointer_cast<hiai::IAITensor>(input_buffer_));
+    }
+    input_buffer_->SetBuffer(static_cast<void *>(buffer), pool_.buffer_size());
+
+    if (output_tensors_.empty()) {
+      hiai::AIStatus ret = ai_model_manager_->CreateOutputTensor(
+          input_tensors_, output_tensors_);
+      if (ret != hiai::SUCCESS) {
+        HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                        "call CreateOutputTensor failed");
+        output_tensors_.clear();
+        return false;
+      }
+    }
+
+    hiai::AIContext ai_context;
+    hiai::AIStatus ret = ai_model_manager_->Process(
+        ai_context, input_tensors_, output_tensors_, kStageProcessTimeout);
+    if (ret != hiai::SUCCESS) {
+      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT, "call Process failed");
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief: accumulate the timing of one batch and log it periodically
+   */
+  void RecordStats(int32_t valid_num, Clock::time_point pre_begin,
+                   Clock::time_point inference_begin,
+                   Clock::time_point post_begin, Clock::time_point post_end) {
+    stats_.runs++;
+    stats_.items += valid_num;
+    stats_.pre_process_us += ElapsedUs(pre_begin, inference_begin);
+    stats_.inference_us += ElapsedUs(inference_begin, post_begin);
+    stats_.post_process_us += ElapsedUs(post_begin, post_end);
+    if (stats_.runs % kStageStatsLogInterval == 0) {
+      HIAI_ENGINE_LOG("stage runs=%" PRIu64 ", items=%" PRIu64
+                      ", average pre=%" PRIu64 " us, inference=%" PRIu64
+                      " us, post=%" PRIu64 " us, buffer pool hits=%" PRIu64
+                      ", misses=%" PRIu64,
+                      stats_.runs, stats_.items,
+                      stats_.pre_process_us / stats_.runs,
+                      stats_.inference_us / stats_.runs,
+                      stats_.post_process_us / stats_.runs,
+                      pool_.hits(), pool_.misses());
+    }
+  }
+
+  static uint64_t ElapsedUs(Clock::time_point begin, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        end - begin).count();
+  }
+
+  int32_t batch_size_;
+  int32_t warm_up_times_;
+  uint32_t item_size_;
+
+  // AI model manager
+  std::shared_ptr<hiai::AIModelManager> ai_model_manager_;
+  std::string model_name_;
+
+  // input staging buffers, one is borrowed by every batch
+  StagingBufferPool pool_;
+
+  // tensors reused by every batch, the input points to the batch buffer
+  std::shared_ptr<hiai::AINeuralNetworkBuffer> input_buffer_;
+  std::vector<std::shared_ptr<hiai::IAITensor>> input_tensors_;
+  std::vector<std::shared_ptr<hiai::IAITensor>> output_tensors_;
+
+  // model manager and tensors are used by one batch at a time
+  mutable std::mutex mutex_;
+  StageStats stats_;
+};
+
+#endif /* INFERENCE_STAGE_H_ */
@@ -37,7 +37,7 @@ namespace protobuf_presenter_5fmessage_2eproto {
 struct TableStruct {
   static const ::google::protobuf::internal::ParseTableField entries[];
   static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[7];
+  static const ::google::protobuf::internal::ParseTable schema[8];
   static const ::google::protobuf::internal::FieldMetadata field_metadata[];
   static const ::google::protobuf::internal::SerializationTable serialization_table[];
   static const ::google::protobuf::uint32 offsets[];
@@ -57,6 +57,8 @@ void InitDefaultsPresentImageRequestImpl();
 void InitDefaultsPresentImageRequest();
 void InitDefaultsPresentImageResponseImpl();
 void InitDefaultsPresentImageResponse();
+void InitDefaultsPresentResultsRequestImpl();
+void InitDefaultsPresentResultsRequest();
 inline void InitDefaults() {
   InitDefaultsOpenChannelRequest();
   InitDefaultsOpenChannelResponse();
@@ -65,6 +67,7 @@ inline void InitDefaults() {
   InitDefaultsRectangle_Attr();
   InitDefaultsPresentImageRequest();
   InitDefaultsPresentImageResponse();
+  InitDefaultsPresentResultsRequest();
 }
 }  // namespace protobuf_presenter_5fmessage_2eproto
 namespace ascend {
@@ -88,6 +91,9 @@ extern PresentImageRequestDefaultTypeInternal _PresentImageRequest_default_insta
 class PresentImageResponse;
 class PresentImageResponseDefaultTypeInternal;
 extern PresentImageResponseDefaultTypeInternal _PresentImageResponse_default_instance_;
+class PresentResultsRequest;
+class PresentResultsRequestDefaultTypeInternal;
+extern PresentResultsRequestDefaultTypeInternal _PresentResultsRequest_default_instance_;
 class Rectangle_Attr;
 class Rectangle_AttrDefaultTypeInternal;
 extern Rectangle_AttrDefaultTypeInternal _Rectangle_Attr_default_instance_;
@@ -185,6 +191,31 @@ inline bool PresentDataErrorCode_Parse(
   return ::google::protobuf::internal::ParseNamedEnum<PresentDataErrorCode>(
     PresentDataErrorCode_descriptor(), name, value);
 }
+enum LivenessState {
+  kLivenessNone = 0,
+  kLivenessFrontal = 1,
+  kLivenessMouthOpen = 2,
+  kLivenessHeadDown = 3,
+  kLivenessPassed = 4,
+  kLivenessFailed = 5,
+  LivenessState_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
+  LivenessState_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+};
+bool LivenessState_IsValid(int value);
+const LivenessState LivenessState_MIN = kLivenessNone;
+const LivenessState LivenessState_MAX = kLivenessFailed;
+const int LivenessState_ARRAYSIZE = LivenessState_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* LivenessState_descriptor();
+inline const ::std::string& LivenessState_Name(LivenessState value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    LivenessState_descriptor(), value);
+}
+inline bool LivenessState_Parse(
+    const ::std::string& name, LivenessState* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<LivenessState>(
+    LivenessState_descriptor(), name, value);
+}
 // ===================================================================
 
 class OpenChannelRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ascend.presenter.proto.OpenChannelRequest) */ {
@@ -860,6 +891,20 @@ class PresentImageRequest : public ::google::protobuf::Message /* @@protoc_inser
   ::std::string* release_data();
   void set_allocated_data(::std::string* data);
 
+  // bytes face_data = 7;
+  void clear_face_data();
+  static const int kFaceDataFieldNumber = 7;
+  const ::std::string& face_data() const;
+  void set_face_data(const ::std::string& value);
+  #if LANG_CXX11
+  void set_face_data(::std::string&& value);
+  #endif
+  void set_face_data(const char* value);
+  void set_face_data(const void* value, size_t size);
+  ::std::string* mutable_face_data();
+  ::std::string* release_face_data();
+  void set_allocated_face_data(::std::string* face_data);
+
   // .ascend.presenter.proto.ImageFormat format = 1;
   void clear_format();
   static const int kFormatFieldNumber = 1;
@@ -878,6 +923,12 @@ class PresentImageRequest : public ::google::protobuf::Message /* @@protoc_inser
   ::google::protobuf::uint32 height() const;
   void set_height(::google::protobuf::uint32 value);
 
+  // .ascend.presenter.proto.LivenessState liveness = 8;
+  void clear_liveness();
+  static const int kLivenessFieldNumber = 8;
+  ::ascend::presenter::proto::LivenessState liveness() const;
+  void set_liveness(::ascend::presenter::proto::LivenessState value);
+
   // @@protoc_insertion_point(class_scope:ascend.presenter.proto.PresentImageRequest)
  private:
 
@@ -885,9 +936,11 @@ class PresentImageRequest : public ::google::protobuf::Message /* @@protoc_inser
   ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Rectangle_Attr > rectangle_list_;
   ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Coordinate > point_list_;
   ::google::protobuf::internal::ArenaStringPtr data_;
+  ::google::protobuf::internal::ArenaStringPtr face_data_;
   int format_;
   ::google::protobuf::uint32 width_;
   ::google::protobuf::uint32 height_;
+  int liveness_;
   mutable int _cached_size_;
   friend struct ::protobuf_presenter_5fmessage_2eproto::TableStruct;
   friend void ::protobuf_presenter_5fmessage_2eproto::InitDefaultsPresentImageRequestImpl();
@@ -996,16 +1049,177 @@ class PresentImageResponse : public ::google::protobuf::Message /* @@protoc_inse
   ::ascend::presenter::proto::PresentDataErrorCode error_code() const;
   void set_error_code(::ascend::presenter::proto::PresentDataErrorCode value);
 
+  // uint32 viewer_count = 3;
+  void clear_viewer_count();
+  static const int kViewerCountFieldNumber = 3;
+  ::google::protobuf::uint32 viewer_count() const;
+  void set_viewer_count(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:ascend.presenter.proto.PresentImageResponse)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::internal::ArenaStringPtr error_message_;
   int error_code_;
+  ::google::protobuf::uint32 viewer_count_;
   mutable int _cached_size_;
   friend struct ::protobuf_presenter_5fmessage_2eproto::TableStruct;
   friend void ::protobuf_presenter_5fmessage_2eproto::InitDefaultsPresentImageResponseImpl();
 };
+// -------------------------------------------------------------------
+
+class PresentResultsRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:ascend.presenter.proto.PresentResultsRequest) */ {
+ public:
+  PresentResultsRequest();
+  virtual ~PresentResultsRequest();
+
+  PresentResultsRequest(const PresentResultsRequest& from);
+
+  inline PresentResultsRequest& operator=(const PresentResultsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  #if LANG_CXX11
+  PresentResultsRequest(PresentResultsRequest&& from) noexcept
+    : PresentResultsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PresentResultsRequest& operator=(PresentResultsRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+  #endif
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const PresentResultsRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PresentResultsRequest* internal_default_instance() {
+    return reinterpret_cast<const PresentResultsRequest*>(
+               &_PresentResultsRequest_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    7;
+
+  void Swap(PresentResultsRequest* other);
+  friend void swap(PresentResultsRequest& a, PresentResultsRequest& b) {
+    a.Swap(&b);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PresentResultsRequest* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  PresentResultsRequest* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const PresentResultsRequest& from);
+  void MergeFrom(const PresentResultsRequest& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(PresentResultsRequest* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .ascend.presenter.proto.Rectangle_Attr rectangle_list = 5;
+  int rectangle_list_size() const;
+  void clear_rectangle_list();
+  static const int kRectangleListFieldNumber = 5;
+  const ::ascend::presenter::proto::Rectangle_Attr& rectangle_list(int index) const;
+  ::ascend::presenter::proto::Rectangle_Attr* mutable_rectangle_list(int index);
+  ::ascend::presenter::proto::Rectangle_Attr* add_rectangle_list();
+  ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Rectangle_Attr >*
+      mutable_rectangle_list();
+  const ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Rectangle_Attr >&
+      rectangle_list() const;
+
+  // repeated .ascend.presenter.proto.Coordinate point_list = 6;
+  int point_list_size() const;
+  void clear_point_list();
+  static const int kPointListFieldNumber = 6;
+  const ::ascend::presenter::proto::Coordinate& point_list(int index) const;
+  ::ascend::presenter::proto::Coordinate* mutable_point_list(int index);
+  ::ascend::presenter::proto::Coordinate* add_point_list();
+  ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Coordinate >*
+      mutable_point_list();
+  const ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Coordinate >&
+      point_list() const;
+
+  // bytes face_data = 7;
+  void clear_face_data();
+  static const int kFaceDataFieldNumber = 7;
+  const ::std::string& face_data() const;
+  void set_face_data(const ::std::string& value);
+  #if LANG_CXX11
+  void set_face_data(::std::string&& value);
+  #endif
+  void set_face_data(const char* value);
+  void set_face_data(const void* value, size_t size);
+  ::std::string* mutable_face_data();
+  ::std::string* release_face_data();
+  void set_allocated_face_data(::std::string* face_data);
+
+  // uint32 width = 2;
+  void clear_width();
+  static const int kWidthFieldNumber = 2;
+  ::google::protobuf::uint32 width() const;
+  void set_width(::google::protobuf::uint32 value);
+
+  // uint32 height = 3;
+  void clear_height();
+  static const int kHeightFieldNumber = 3;
+  ::google::protobuf::uint32 height() const;
+  void set_height(::google::protobuf::uint32 value);
+
+  // .ascend.presenter.proto.LivenessState liveness = 8;
+  void clear_liveness();
+  static const int kLivenessFieldNumber = 8;
+  ::ascend::presenter::proto::LivenessState liveness() const;
+  void set_liveness(::ascend::presenter::proto::LivenessState value);
+
+  // @@protoc_insertion_point(class_scope:ascend.presenter.proto.PresentResultsRequest)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Rectangle_Attr > rectangle_list_;
+  ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Coordinate > point_list_;
+  ::google::protobuf::internal::ArenaStringPtr face_data_;
+  ::google::protobuf::uint32 width_;
+  ::google::protobuf::uint32 height_;
+  int liveness_;
+  mutable int _cached_size_;
+  friend struct ::protobuf_presenter_5fmessage_2eproto::TableStruct;
+  friend void ::protobuf_presenter_5fmessage_2eproto::InitDefaultsPresentResultsRequestImpl();
+};
 // ===================================================================
 
 
@@ -1507,6 +1721,73 @@ PresentImageRequest::point_list() const {
   return point_list_;
 }
 
+// bytes face_data = 7;
+inline void PresentImageRequest::clear_face_data() {
+  face_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& PresentImageRequest::face_data() const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentImageRequest.face_data)
+  return face_data_.GetNoArena();
+}
+inline void PresentImageRequest::set_face_data(const ::std::string& value) {
+  
+  face_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:ascend.presenter.proto.PresentImageRequest.face_data)
+}
+#if LANG_CXX11
+inline void PresentImageRequest::set_face_data(::std::string&& value) {
+  
+  face_data_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:ascend.presenter.proto.PresentImageRequest.face_data)
+}
+#endif
+inline void PresentImageRequest::set_face_data(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  face_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:ascend.presenter.proto.PresentImageRequest.face_data)
+}
+inline void PresentImageRequest::set_face_data(const void* value, size_t size) {
+  
+  face_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:ascend.presenter.proto.PresentImageRequest.face_data)
+}
+inline ::std::string* PresentImageRequest::mutable_face_data() {
+  
+  // @@protoc_insertion_point(field_mutable:ascend.presenter.proto.PresentImageRequest.face_data)
+  return face_data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* PresentImageRequest::release_face_data() {
+  // @@protoc_insertion_point(field_release:ascend.presenter.proto.PresentImageRequest.face_data)
+  
+  return face_data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void PresentImageRequest::set_allocated_face_data(::std::string* face_data) {
+  if (face_data != NULL) {
+    
+  } else {
+    
+  }
+  face_data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), face_data);
+  // @@protoc_insertion_point(field_set_allocated:ascend.presenter.proto.PresentImageRequest.face_data)
+}
+
+// .ascend.presenter.proto.LivenessState liveness = 8;
+inline void PresentImageRequest::clear_liveness() {
+  liveness_ = 0;
+}
+inline ::ascend::presenter::proto::LivenessState PresentImageRequest::liveness() const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentImageRequest.liveness)
+  return static_cast< ::ascend::presenter::proto::LivenessState >(liveness_);
+}
+inline void PresentImageRequest::set_liveness(::ascend::presenter::proto::LivenessState value) {
+  
+  liveness_ = value;
+  // @@protoc_insertion_point(field_set:ascend.presenter.proto.PresentImageRequest.liveness)
+}
+
 // -------------------------------------------------------------------
 
 // PresentImageResponse
@@ -1578,6 +1859,179 @@ inline void PresentImageResponse::set_allocated_error_message(::std::string* err
   // @@protoc_insertion_point(field_set_allocated:ascend.presenter.proto.PresentImageResponse.error_message)
 }
 
+// uint32 viewer_count = 3;
+inline void PresentImageResponse::clear_viewer_count() {
+  viewer_count_ = 0u;
+}
+inline ::google::protobuf::uint32 PresentImageResponse::viewer_count() const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentImageResponse.viewer_count)
+  return viewer_count_;
+}
+inline void PresentImageResponse::set_viewer_count(::google::protobuf::uint32 value) {
+  
+  viewer_count_ = value;
+  // @@protoc_insertion_point(field_set:ascend.presenter.proto.PresentImageResponse.viewer_count)
+}
+
+// -------------------------------------------------------------------
+
+// PresentResultsRequest
+
+// uint32 width = 2;
+inline void PresentResultsRequest::clear_width() {
+  width_ = 0u;
+}
+inline ::google::protobuf::uint32 PresentResultsRequest::width() const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentResultsRequest.width)
+  return width_;
+}
+inline void PresentResultsRequest::set_width(::google::protobuf::uint32 value) {
+  
+  width_ = value;
+  // @@protoc_insertion_point(field_set:ascend.presenter.proto.PresentResultsRequest.width)
+}
+
+// uint32 height = 3;
+inline void PresentResultsRequest::clear_height() {
+  height_ = 0u;
+}
+inline ::google::protobuf::uint32 PresentResultsRequest::height() const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentResultsRequest.height)
+  return height_;
+}
+inline void PresentResultsRequest::set_height(::google::protobuf::uint32 value) {
+  
+  height_ = value;
+  // @@protoc_insertion_point(field_set:ascend.presenter.proto.PresentResultsRequest.height)
+}
+
+// repeated .ascend.presenter.proto.Rectangle_Attr rectangle_list = 5;
+inline int PresentResultsRequest::rectangle_list_size() const {
+  return rectangle_list_.size();
+}
+inline void PresentResultsRequest::clear_rectangle_list() {
+  rectangle_list_.Clear();
+}
+inline const ::ascend::presenter::proto::Rectangle_Attr& PresentResultsRequest::rectangle_list(int index) const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentResultsRequest.rectangle_list)
+  return rectangle_list_.Get(index);
+}
+inline ::ascend::presenter::proto::Rectangle_Attr* PresentResultsRequest::mutable_rectangle_list(int index) {
+  // @@protoc_insertion_point(field_mutable:ascend.presenter.proto.PresentResultsRequest.rectangle_list)
+  return rectangle_list_.Mutable(index);
+}
+inline ::ascend::presenter::proto::Rectangle_Attr* PresentResultsRequest::add_rectangle_list() {
+  // @@protoc_insertion_point(field_add:ascend.presenter.proto.PresentResultsRequest.rectangle_list)
+  return rectangle_list_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Rectangle_Attr >*
+PresentResultsRequest::mutable_rectangle_list() {
+  // @@protoc_insertion_point(field_mutable_list:ascend.presenter.proto.PresentResultsRequest.rectangle_list)
+  return &rectangle_list_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Rectangle_Attr >&
+PresentResultsRequest::rectangle_list() const {
+  // @@protoc_insertion_point(field_list:ascend.presenter.proto.PresentResultsRequest.rectangle_list)
+  return rectangle_list_;
+}
+
+// repeated .ascend.presenter.proto.Coordinate point_list = 6;
+inline int PresentResultsRequest::point_list_size() const {
+  return point_list_.size();
+}
+inline void PresentResultsRequest::clear_point_list() {
+  point_list_.Clear();
+}
+inline const ::ascend::presenter::proto::Coordinate& PresentResultsRequest::point_list(int index) const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentResultsRequest.point_list)
+  return point_list_.Get(index);
+}
+inline ::ascend::presenter::proto::Coordinate* PresentResultsRequest::mutable_point_list(int index) {
+  // @@protoc_insertion_point(field_mutable:ascend.presenter.proto.PresentResultsRequest.point_list)
+  return point_list_.Mutable(index);
+}
+inline ::ascend::presenter::proto::Coordinate* PresentResultsRequest::add_point_list() {
+  // @@protoc_insertion_point(field_add:ascend.presenter.proto.PresentResultsRequest.point_list)
+  return point_list_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Coordinate >*
+PresentResultsRequest::mutable_point_list() {
+  // @@protoc_insertion_point(field_mutable_list:ascend.presenter.proto.PresentResultsRequest.point_list)
+  return &point_list_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::ascend::presenter::proto::Coordinate >&
+PresentResultsRequest::point_list() const {
+  // @@protoc_insertion_point(field_list:ascend.presenter.proto.PresentResultsRequest.point_list)
+  return point_list_;
+}
+
+// bytes face_data = 7;
+inline void PresentResultsRequest::clear_face_data() {
+  face_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& PresentResultsRequest::face_data() const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentResultsRequest.face_data)
+  return face_data_.GetNoArena();
+}
+inline void PresentResultsRequest::set_face_data(const ::std::string& value) {
+  
+  face_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:ascend.presenter.proto.PresentResultsRequest.face_data)
+}
+#if LANG_CXX11
+inline void PresentResultsRequest::set_face_data(::std::string&& value) {
+  
+  face_data_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:ascend.presenter.proto.PresentResultsRequest.face_data)
+}
+#endif
+inline void PresentResultsRequest::set_face_data(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  face_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:ascend.presenter.proto.PresentResultsRequest.face_data)
+}
+inline void PresentResultsRequest::set_face_data(const void* value, size_t size) {
+  
+  face_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:ascend.presenter.proto.PresentResultsRequest.face_data)
+}
+inline ::std::string* PresentResultsRequest::mutable_face_data() {
+  
+  // @@protoc_insertion_point(field_mutable:ascend.presenter.proto.PresentResultsRequest.face_data)
+  return face_data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* PresentResultsRequest::release_face_data() {
+  // @@protoc_insertion_point(field_release:ascend.presenter.proto.PresentResultsRequest.face_data)
+  
+  return face_data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void PresentResultsRequest::set_allocated_face_data(::std::string* face_data) {
+  if (face_data != NULL) {
+    
+  } else {
+    
+  }
+  face_data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), face_data);
+  // @@protoc_insertion_point(field_set_allocated:ascend.presenter.proto.PresentResultsRequest.face_data)
+}
+
+// .ascend.presenter.proto.LivenessState liveness = 8;
+inline void PresentResultsRequest::clear_liveness() {
+  liveness_ = 0;
+}
+inline ::ascend::presenter::proto::LivenessState PresentResultsRequest::liveness() const {
+  // @@protoc_insertion_point(field_get:ascend.presenter.proto.PresentResultsRequest.liveness)
+  return static_cast< ::ascend::presenter::proto::LivenessState >(liveness_);
+}
+inline void PresentResultsRequest::set_liveness(::ascend::presenter::proto::LivenessState value) {
+  
+  liveness_ = value;
+  // @@protoc_insertion_point(field_set:ascend.presenter.proto.PresentResultsRequest.liveness)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1593,6 +2047,8 @@ inline void PresentImageResponse::set_allocated_error_message(::std::string* err
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1623,6 +2079,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::ascend::presenter::proto::PresentDataErrorCode>() {
   return ::ascend::presenter::proto::PresentDataErrorCode_descriptor();
 }
+template <> struct is_proto_enum< ::ascend::presenter::proto::LivenessState> : ::google::protobuf::internal::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ascend::presenter::proto::LivenessState>() {
+  return ::ascend::presenter::proto::LivenessState_descriptor();
+}
 
 }  // namespace protobuf
 }  // namespace google
@@ -0,0 +1,173 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef STAGING_BUFFER_POOL_H_
+#define STAGING_BUFFER_POOL_H_
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// alignment of every staging buffer, one cache line
+const size_t kStagingBufferAlign = 64;
+
+/**
+ * @brief: pool of equally sized, aligned model input buffers.
+ *         A buffer is borrowed by Acquire and given back when its handle
+ *         is destroyed, so no error path can leak it.
+ */
+class StagingBufferPool {
+ public:
+  /**
+   * @brief: borrowed buffer, returned to the pool on destruction
+   */
+  class Buffer {
+   public:
+    Buffer() : pool_(nullptr), data_(nullptr), size_(0) {}
+    Buffer(StagingBufferPool *pool, uint8_t *data, size_t size)
+        : pool_(pool), data_(data), size_(size) {}
+    Buffer(Buffer &&other)
+        : pool_(other.pool_), data_(other.data_), size_(other.size_) {
+      other.data_ = nullptr;
+    }
+    Buffer(const Buffer &) = delete;
+    Buffer &operator=(const Buffer &) = delete;
+    ~Buffer() {
+      if (data_ != nullptr) {
+        pool_->Release(data_, size_);
+      }
+    }
+
+    uint8_t *get() const {
+      return data_;
+    }
+
+    // bytes of this buffer, the pool size when it was acquired
+    size_t size() const {
+      return size_;
+    }
+
+   private:
+    StagingBufferPool *pool_;
+    uint8_t *data_;
+    size_t size_;
+  };
+
+  StagingBufferPool() : buffer_size_(0), max_free_(0), hits_(0), misses_(0) {}
+
+  // every Buffer must be destroyed before the pool
+  ~StagingBufferPool() {
+    for (uint8_t *data : free_buffers_) {
+      free(data);
+    }
+  }
+
+  /**
+   * @brief: set the buffer size and allocate the first buffer
+   * @param [in]: buffer_size: bytes of every buffer
+   * @param [in]: max_free: most idle buffers kept in the pool
+   * @return: true: success; false: out of memory, the pool stays
+   *          uninitialized and buffer_size() is 0
+   */
+  bool Init(size_t buffer_size, size_t max_free) {
+    max_free_ = max_free;
+    uint8_t *data = Allocate(buffer_size);
+    if (data == nullptr) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_buffers_.push_back(data);
+    buffer_size_ = buffer_size;
+    return true;
+  }
+
+  /**
+   * @brief: change the size of the buffers acquired from now on. Idle
+   *         buffers are freed, borrowed ones are freed when given back
+   * @param [in]: buffer_size: bytes of every buffer
+   */
+  void Resize(size_t buffer_size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_size_ = buffer_size;
+    for (uint8_t *data : free_buffers_) {
+      free(data);
+    }
+    free_buffers_.clear();
+  }
+
+  /**
+   * @brief: borrow a buffer, get() of the handle is nullptr when out of memory
+   */
+  Buffer Acquire() {
+    size_t buffer_size = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      buffer_size = buffer_size_;
+      if (!free_buffers_.empty()) {
+        uint8_t *data = free_buffers_.back();
+        free_buffers_.pop_back();
+        hits_++;
+        return Buffer(this, data, buffer_size);
+      }
+    }
+    misses_++;
+    uint8_t *data = Allocate(buffer_size);
+    return (data == nullptr) ? Buffer() : Buffer(this, data, buffer_size);
+  }
+
+  size_t buffer_size() const {
+    return buffer_size_;
+  }
+
+  // Acquire served by an idle buffer
+  uint64_t hits() const {
+    return hits_;
+  }
+
+  // Acquire which allocated a new buffer
+  uint64_t misses() const {
+    return misses_;
+  }
+
+ private:
+  /**
+   * @brief: allocate an aligned buffer, zeroed so that padding slots of a
+   *         batch never hold uninitialized memory
+   */
+  uint8_t *Allocate(size_t buffer_size) {
+    void *data = nullptr;
+    if ((buffer_size == 0)
+        || (posix_memalign(&data, kStagingBufferAlign, buffer_size) != 0)) {
+      return nullptr;
+    }
+    memset(data, 0, buffer_size);
+    return static_cast<uint8_t *>(data);
+  }
+
+  // a buffer of an older size is freed instead of kept
+  void Release(uint8_t *data, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ((size == buffer_size_) && (free_buffers_.size() < max_free_)) {
+      free_buffers_.push_back(data);
+    } else {
+      free(data);
+    }
+  }
+
+  std::atomic<size_t> buffer_size_;
+  size_t max_free_;
+  std::mutex mutex_;
+  std::vector<uint8_t *> free_buffers_;
+  std::atomic<uint64_t> hits_;
+  std::atomic<uint64_t> misses_;
+};
+
+#endif /* STAGING_BUFFER_POOL_H_ */
@@ -0,0 +1,60 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef STARTUP_TIMER_H_
+#define STARTUP_TIMER_H_
+
+#include <chrono>
+#include <string>
+
+#include "hiaiengine/log.h"
+
+/**
+ * @brief: startup timing of one engine, every phase logs the time passed
+ *         since the previous phase, Finish logs the whole Init
+ */
+class StartupTimer {
+ public:
+  explicit StartupTimer(const std::string &engine_name)
+      : engine_name_(engine_name),
+        begin_(Clock::now()),
+        phase_begin_(begin_) {}
+
+  /**
+   * @brief: end the current phase and log its time
+   * @param [in]: phase: phase name, such as "model load"
+   */
+  void Phase(const char *phase) {
+    Clock::time_point now = Clock::now();
+    HIAI_ENGINE_LOG("%s startup phase %s took %lld ms", engine_name_.c_str(),
+                    phase, ElapsedMs(phase_begin_, now));
+    phase_begin_ = now;
+  }
+
+  /**
+   * @brief: log the whole startup time, call it when engine is ready
+   */
+  void Finish() {
+    HIAI_ENGINE_LOG("%s startup finished in %lld ms", engine_name_.c_str(),
+                    ElapsedMs(begin_, Clock::now()));
+  }
+
+ private:
+  typedef std::chrono::steady_clock Clock;
+
+  static long long ElapsedMs(Clock::time_point begin, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        end - begin).count();
+  }
+
+  std::string engine_name_;
+  Clock::time_point begin_;
+  Clock::time_point phase_begin_;
+};
+
+#endif /* STARTUP_TIMER_H_ */
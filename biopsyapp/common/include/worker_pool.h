@@ -0,0 +1,383 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+#ifndef WORKER_POOL_H_
+#define WORKER_POOL_H_
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "hiaiengine/ai_types.h"
+#include "hiaiengine/log.h"
+
+// worker number parameter key in graph.config, 0 means run on the caller
+const std::string kWorkerNumParamKey = "worker_num";
+
+// worker cpu parameter key in graph.config, such as "1,2,3", empty means
+// no affinity, worker i runs on the (i % n)-th cpu of the list
+const std::string kWorkerCpusParamKey = "worker_cpus";
+
+// most tasks queued in the pool, more tasks run on the caller
+const size_t kWorkerPoolCapacity = 64;
+
+// log the task timing every N tasks
+const uint64_t kWorkerPoolLogInterval = 1000;
+
+/**
+ * @brief: accumulated task timing of the pool (unit: microseconds)
+ */
+struct WorkerPoolStats {
+  uint64_t tasks = 0;  // tasks run, by the workers or the caller
+  uint64_t caller_tasks = 0;  // tasks run by the caller of ParallelFor
+  uint64_t steals = 0;  // tasks taken from the queue of another worker
+  uint64_t overflows = 0;  // tasks run by the caller as the pool was full
+  uint64_t task_us = 0;
+  uint64_t max_task_us = 0;
+};
+
+/**
+ * @brief: bounded work-stealing pool shared by all engines of the process.
+ *         Every worker owns a queue, it runs its own newest task first and
+ *         steals the oldest task of the others when idle. ParallelFor
+ *         splits a loop into tasks, the caller runs tasks too until the
+ *         loop is done, so it is safe to call it from a worker.
+ */
+class WorkerPool {
+ public:
+  /**
+   * @brief: the pool of the process
+   */
+  static WorkerPool &Instance() {
+    static WorkerPool pool;
+    return pool;
+  }
+
+  /**
+   * @brief: start the workers, only the first call takes effect
+   * @param [in]: worker_num: number of workers, 0 means no worker
+   * @param [in]: cpus: cpus for worker affinity, empty means no affinity
+   */
+  void Start(int32_t worker_num, const std::vector<int32_t> &cpus) {
+    std::lock_guard<std::mutex> lock(start_mutex_);
+    if (started_) {
+      if (worker_num != static_cast<int32_t>(queues_.size())) {
+        HIAI_ENGINE_LOG("worker pool already started with %zu workers, "
+                        "worker_num=%d is ignored", queues_.size(),
+                        worker_num);
+      }
+      return;
+    }
+    started_ = true;
+    for (int32_t i = 0; i < worker_num; ++i) {
+      queues_.emplace_back(new TaskQueue());
+    }
+    for (int32_t i = 0; i < worker_num; ++i) {
+      workers_.emplace_back(&WorkerPool::WorkerLoop, this, i);
+      if (!cpus.empty()) {
+        SetAffinity(workers_.back(), cpus[i % cpus.size()]);
+      }
+    }
+    HIAI_ENGINE_LOG("worker pool started with %d workers, %zu cpus",
+                    worker_num, cpus.size());
+  }
+
+  /**
+   * @brief: run task(0) ... task(count - 1) in parallel and wait for all.
+   *         Every task must only touch the data of its own index, so the
+   *         result does not depend on which thread runs it.
+   * @param [in]: count: number of tasks
+   * @param [in]: task: returns false when failed
+   * @return: true: all tasks succeeded; false: any task failed
+   */
+  bool ParallelFor(int32_t count, const std::function<bool(int32_t)> &task) {
+    if (count <= 0) {
+      return true;
+    }
+    std::shared_ptr<Loop> loop = std::make_shared<Loop>(count, task);
+
+    // the caller runs index 0, the others are queued while there is room
+    for (int32_t index = 1; index < count; ++index) {
+      if (queues_.empty() || !Push(loop, index)) {
+        if (!queues_.empty()) {
+          overflows_++;
+        }
+        RunTask(*loop, index, true);
+      }
+    }
+    RunTask(*loop, 0, true);
+
+    // help with any queued task instead of sleeping. when nothing is queued
+    // every task of this loop is running on another thread, tasks only
+    // leave the queues, so waiting for them can not miss a task
+    while (loop->remaining.load() > 0) {
+      Task stolen;
+      if (Pop(-1, stolen)) {
+        RunTask(*stolen.loop, stolen.index, true);
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(loop->mutex);
+      loop->done.wait(lock, [&loop]() {
+        return loop->remaining.load() == 0;
+      });
+    }
+    return !loop->failed.load();
+  }
+
+  /**
+   * @brief: accumulated task timing
+   */
+  WorkerPoolStats stats() const {
+    WorkerPoolStats snapshot;
+    snapshot.tasks = tasks_.load();
+    snapshot.caller_tasks = caller_tasks_.load();
+    snapshot.steals = steals_.load();
+    snapshot.overflows = overflows_.load();
+    snapshot.task_us = task_us_.load();
+    snapshot.max_task_us = max_task_us_.load();
+    return snapshot;
+  }
+
+  ~WorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(idle_mutex_);
+      stopping_ = true;
+    }
+    work_ready_.notify_all();
+    for (std::thread &worker : workers_) {
+      worker.join();
+    }
+  }
+
+ private:
+  typedef std::chrono::steady_clock Clock;
+
+  /**
+   * @brief: one ParallelFor call
+   */
+  struct Loop {
+    Loop(int32_t count, const std::function<bool(int32_t)> &task)
+        : task(task), remaining(count), failed(false) {}
+    std::function<bool(int32_t)> task;
+    std::atomic<int32_t> remaining;
+    std::atomic<bool> failed;
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+
+  /**
+   * @brief: one index of a loop
+   */
+  struct Task {
+    std::shared_ptr<Loop> loop;
+    int32_t index = 0;
+  };
+
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  WorkerPool()
+      : started_(false), stopping_(false), next_queue_(0), queued_(0),
+        tasks_(0), caller_tasks_(0), steals_(0), overflows_(0), task_us_(0),
+        max_task_us_(0) {}
+
+  static void SetAffinity(std::thread &worker, int32_t cpu) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    int ret = pthread_setaffinity_np(worker.native_handle(), sizeof(cpu_set),
+                                     &cpu_set);
+    if (ret != 0) {
+      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                      "set worker affinity to cpu %d failed, ret=%d", cpu,
+                      ret);
+    }
+  }
+
+  /**
+   * @brief: queue a task round robin
+   * @return: false when the pool is full
+   */
+  bool Push(const std::shared_ptr<Loop> &loop, int32_t index) {
+    if (queued_.fetch_add(1) >= kWorkerPoolCapacity) {
+      queued_--;
+      return false;
+    }
+    size_t target = next_queue_.fetch_add(1) % queues_.size();
+    TaskQueue &queue = *queues_[target];
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      Task task;
+      task.loop = loop;
+      task.index = index;
+      queue.tasks.push_back(task);
+    }
+    // any idle worker takes it, its own or by stealing. queued_ is counted
+    // before the lock, so a worker about to wait sees it
+    {
+      std::lock_guard<std::mutex> lock(idle_mutex_);
+    }
+    work_ready_.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief: take the newest task of the own queue, or steal the oldest task
+   *         of another queue
+   * @param [in]: self: worker index, -1 for a caller which is no worker
+   */
+  bool Pop(int32_t self, Task &task) {
+    if (self >= 0) {
+      TaskQueue &queue = *queues_[self];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = queue.tasks.back();
+        queue.tasks.pop_back();
+        queued_--;
+        return true;
+      }
+    }
+    for (size_t i = 1; i <= queues_.size(); ++i) {
+      size_t victim = (self + i) % queues_.size();
+      if (static_cast<int32_t>(victim) == self) {
+        continue;
+      }
+      TaskQueue &queue = *queues_[victim];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = queue.tasks.front();
+        queue.tasks.pop_front();
+        queued_--;
+        if (self >= 0) {
+          steals_++;
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void WorkerLoop(int32_t self) {
+    while (!stopping_) {
+      Task task;
+      if (Pop(self, task)) {
+        RunTask(*task.loop, task.index, false);
+        continue;
+      }
+      // sleep until a task is queued anywhere
+      std::unique_lock<std::mutex> lock(idle_mutex_);
+      work_ready_.wait(lock, [this]() {
+        return stopping_ || (queued_.load() > 0);
+      });
+    }
+  }
+
+  void RunTask(Loop &loop, int32_t index, bool by_caller) {
+    Clock::time_point begin = Clock::now();
+    if (!loop.task(index)) {
+      loop.failed = true;
+    }
+    uint64_t task_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - begin).count();
+    RecordStats(task_us, by_caller);
+
+    if (--loop.remaining == 0) {
+      std::lock_guard<std::mutex> lock(loop.mutex);
+      loop.done.notify_all();
+    }
+  }
+
+  // lock free, the workers never wait for each other to count a task
+  void RecordStats(uint64_t task_us, bool by_caller) {
+    if (by_caller) {
+      caller_tasks_++;
+    }
+    task_us_ += task_us;
+    uint64_t max_task_us = max_task_us_.load();
+    while ((task_us > max_task_us)
+           && !max_task_us_.compare_exchange_weak(max_task_us, task_us)) {
+    }
+    if (++tasks_ % kWorkerPoolLogInterval == 0) {
+      WorkerPoolStats snapshot = stats();
+      HIAI_ENGINE_LOG("worker pool tasks=%" PRIu64 ", by caller=%" PRIu64
+                      ", steals=%" PRIu64 ", overflows=%" PRIu64
+                      ", average=%" PRIu64 " us, max=%" PRIu64 " us",
+                      snapshot.tasks, snapshot.caller_tasks, snapshot.steals,
+                      snapshot.overflows, snapshot.task_us / snapshot.tasks,
+                      snapshot.max_task_us);
+    }
+  }
+
+  std::mutex start_mutex_;
+  bool started_;
+  std::atomic<bool> stopping_;
+
+  // one queue for every worker, fixed after Start
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> next_queue_;
+  std::atomic<size_t> queued_;
+
+  // idle workers wait here until a task is queued to any worker
+  std::mutex idle_mutex_;
+  std::condition_variable work_ready_;
+
+  // counters of WorkerPoolStats
+  std::atomic<uint64_t> tasks_;
+  std::atomic<uint64_t> caller_tasks_;
+  std::atomic<uint64_t> steals_;
+  std::atomic<uint64_t> overflows_;
+  std::atomic<uint64_t> task_us_;
+  std::atomic<uint64_t> max_task_us_;
+};
+
+/**
+ * @brief: start the shared pool from worker_num and worker_cpus in
+ *         graph.config, nothing happens when worker_num is not configured
+ * @param [in]: config: configuration in graph.config
+ */
+inline void StartWorkerPool(const hiai::AIConfig &config) {
+  int32_t worker_num = -1;
+  std::vector<int32_t> cpus;
+  for (int index = 0; index < config.items_size(); ++index) {
+    const hiai::AIConfigItem &item = config.items(index);
+    if (item.name() == kWorkerNumParamKey) {
+      worker_num = atoi(item.value().c_str());
+    } else if (item.name() == kWorkerCpusParamKey) {
+      std::string value = item.value();
+      std::string::size_type begin = 0;
+      while (begin < value.size()) {
+        std::string::size_type end = value.find(',', begin);
+        end = (end == std::string::npos) ? value.size() : end;
+        if (end > begin) {
+          cpus.push_back(atoi(value.substr(begin, end - begin).c_str()));
+        }
+        begin = end + 1;
+      }
+    }
+  }
+  if (worker_num >= 0) {
+    WorkerPool::Instance().Start(worker_num, cpus);
+  }
+}
+
+#endif /* WORKER_POOL_H_ */
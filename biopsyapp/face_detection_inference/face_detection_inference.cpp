@@ -23,9 +23,12 @@ namespace {
 // output port (engine port begin with 0)
 const uint32_t kSendDataPort = 0;
 
+// output port of frames without face, they skip the biopsy engine
+const uint32_t kNoFaceDataPort = 1;
+
 // model need resized image to 300 * 300
-const float kResizeWidth = 300.0;
-const float kResizeHeight = 300.0;
+const float kResizeWidth = RESIZE_WIDTH;
+const float kResizeHeight = RESIZE_HEIGHT;
 
 const float kMoveLeft = -0.15;
 const float kMoveRight = 1.15;
@@ -35,6 +38,19 @@ const float kMoveDown = 1.25;
 // confidence parameter key in graph.config
 const string kConfidenceParamKey = "confidence";
 
+// detection region of interest key in graph.config, "left,up,right,down"
+const string kRoiParamKey = "detection_roi";
+
+// number of values in region of interest
+const int32_t kRoiValueNum = 4;
+
+// pyramid levels key in graph.config
+const string kPyramidLevelsParamKey = "pyramid_levels";
+
+// valid pyramid levels range [0, 4], vpc can reduce at most 1/32
+const int32_t kPyramidLevelsMin = 0;
+const int32_t kPyramidLevelsMax = 4;
+
 // valid confidence range (0.0, 1.0]
 const float kConfidenceMin = 0.0;
 const float kConfidenceMax = 1.0;
@@ -76,10 +92,12 @@ const __useconds_t kSleepInterval = 200000;
 HIAI_REGISTER_DATA_TYPE("FaceRecognitionInfo", FaceRecognitionInfo);
 HIAI_REGISTER_DATA_TYPE("FaceRectangle", FaceRectangle);
 HIAI_REGISTER_DATA_TYPE("FaceImage", FaceImage);
+HIAI_REGISTER_DATA_TYPE("DetectionRoi", DetectionRoi);
 
 face_detection_inference::face_detection_inference() {
-  ai_model_manager_ = nullptr;
   confidence_ = -1.0;  // initialized as invalid value
+  pyramid_levels_ = 0;
+  device_jpeg_quality_ = 0;
 }
 /**
 * @ingroup hiaiengine
@@ -90,36 +108,62 @@ HIAI_StatusT face_detection_inference::Init(const hiai::AIConfig &config,
     const std::vector<hiai::AIModelDescription> &model_desc)
 {
     HIAI_ENGINE_LOG("Start initialize!");
-    // initialize aiModelManager
-    if (ai_model_manager_ == nullptr) {
-    ai_model_manager_ = std::make_shared<hiai::AIModelManager>();
-    }
-
+    StartupTimer startup_timer("face_detection_inference");
     // get parameters from graph.config
-    // set model path and passcode to AI model description
-    hiai::AIModelDescription fd_model_desc;
     for (int index = 0; index < config.items_size(); index++) {
-    const ::hiai::AIConfigItem& item = config.items(index);
-    // get model path
-    if (item.name() == "model_path") {
-        const char* model_path = item.value().data();
-        fd_model_desc.set_path(model_path);
-        } else if (item.name() == kConfidenceParamKey) {  // get confidence
-          stringstream ss(item.value());
-          ss >> confidence_;
+        const ::hiai::AIConfigItem& item = config.items(index);
+        if (item.name() == kConfidenceParamKey) {  // get confidence
+            stringstream ss(item.value());
+            ss >> confidence_;
+        } else if (item.name() == kRoiParamKey && !item.value().empty()) {
+            DetectionRoi roi;
+            if (!ParseRoi(item.value(), roi)) {
+                HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                                "detection_roi=%s which configured is invalid.",
+                                item.value().c_str());
+                return HIAI_ERROR;
+            }
+            UpdateRoi(roi);
+        } else if (item.name() == kPyramidLevelsParamKey) {
+            stringstream ss(item.value());
+            ss >> pyramid_levels_;
+            if ((pyramid_levels_ < kPyramidLevelsMin)
+                || (pyramid_levels_ > kPyramidLevelsMax)) {
+                HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                                "pyramid_levels=%s which configured is invalid.",
+                                item.value().c_str());
+                return HIAI_ERROR;
+            }
+        } else if (item.name() == kDeviceJpegQualityParamKey) {
+            if (!ParseDeviceJpegQuality(item.value(), device_jpeg_quality_)) {
+                HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                                "device_jpeg_quality=%s which configured is invalid.",
+                                item.value().c_str());
+                return HIAI_ERROR;
+            }
         }
     }
 
-    // initialize model manager
-    std::vector<hiai::AIModelDescription> model_desc_vec;
-    model_desc_vec.push_back(fd_model_desc);
-    hiai::AIStatus ret = ai_model_manager_->Init(config, model_desc_vec);
-    // initialize AI model manager failed
-    if (ret != hiai::SUCCESS) {
-    HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE, "initialize AI model failed");
-    return HIAI_ERROR;
+    // initialize model, model path and batch size are parsed by the stage
+    if (!stage_.Init(config)) {
+        return HIAI_ERROR;
+    }
+    startup_timer.Phase("model load");
+
+    // every inference result belongs to one image, batch is fixed as 1
+    if (stage_.batch_size() != 1) {
+        HIAI_ENGINE_LOG(HIAI_GRAPH_INVALID_VALUE,
+                        "face detection only supports batch_size 1");
+        return HIAI_ERROR;
     }
 
+    // pay the lazy initialization of model and dvpp before the first frame
+    if (!WarmUp()) {
+        return HIAI_ERROR;
+    }
+    startup_timer.Phase("warm-up");
+    startup_timer.Finish();
+
     HIAI_ENGINE_LOG("End initialize!");
     return HIAI_OK;
 }
@@ -153,10 +197,57 @@ float face_detection_inference::CorrectionRatio(float ratio) {
   return (tmp > kMaxRatio) ? kMaxRatio : tmp;
 }
 
-//前处理：此处只做了resize->300*300
+bool face_detection_inference::ParseRoi(const string &value,
+                                        DetectionRoi &roi) {
+  int32_t roi_value[kRoiValueNum] = { 0 };
+  stringstream ss(value);
+  char separator = ',';
+  for (int32_t i = 0; i < kRoiValueNum; ++i) {
+    if (i > 0 && !(ss >> separator && separator == ',')) {
+      return false;
+    }
+    if (!(ss >> roi_value[i]) || roi_value[i] < 0) {
+      return false;
+    }
+  }
+
+  roi.left = roi_value[0];
+  roi.up = roi_value[1];
+  roi.right = roi_value[2];
+  roi.down = roi_value[3];
+  return (roi.right > roi.left) && (roi.down > roi.up);
+}
+
+void face_detection_inference::UpdateRoi(const DetectionRoi &roi) {
+  lock_guard<mutex> lock(roi_mutex_);
+  roi_ = roi;
+  HIAI_ENGINE_LOG("detection roi is (%u,%u)-(%u,%u)", roi.left, roi.up,
+                  roi.right, roi.down);
+}
+
+DetectionRoi face_detection_inference::GetEffectiveRoi(uint32_t width,
+                                                       uint32_t height) {
+  DetectionRoi roi;
+  {
+    lock_guard<mutex> lock(roi_mutex_);
+    roi = roi_;
+  }
+
+  // empty or out of image, detect on the full frame
+  if (!AlignCropArea(width, height, roi)) {
+    roi.left = 0;
+    roi.up = 0;
+    roi.right = width;
+    roi.down = height;
+    AlignCropArea(width, height, roi);
+  }
+  return roi;
+}
+
+//前处理：裁剪检测区域(roi)并resize->300*300
 bool face_detection_inference::PreProcess(
     const shared_ptr<FaceRecognitionInfo> &image_handle,
-    ImageData<u_int8_t> &resized_image) {
+    uint8_t *output_buf, uint32_t output_size, DetectionRoi &roi) {
     // input size is less than zero, return failed
     int32_t img_size = image_handle->org_img.size;
     if (img_size <= 0) {
@@ -178,15 +269,15 @@ bool face_detection_inference::PreProcess(
     resize_para.src_resolution.width = width;
     resize_para.src_resolution.height = height;
 
-    // crop parameters, only resize, no need crop, so set original image size
+    // crop parameters, crop the region of interest in the same vpc call,
+    // it is the original image size when no roi configured
+    roi = GetEffectiveRoi(width, height);
     // set crop left-top point (need even number)
-    resize_para.crop_left = 0;
-    resize_para.crop_up = 0;
+    resize_para.crop_left = roi.left;
+    resize_para.crop_up = roi.up;
     // set crop right-bottom point (need odd number)
-    uint32_t crop_right = ((width >> 1) << 1) - 1;
-    uint32_t crop_down = ((height >> 1) << 1) - 1;
-    resize_para.crop_right = crop_right;
-    resize_para.crop_down = crop_down;
+    resize_para.crop_right = roi.right;
+    resize_para.crop_down = roi.down;
 
     // set destination resolution ratio (need even number)
     resize_para.dest_resolution.width = kResizeWidth;
@@ -197,67 +288,38 @@ bool face_detection_inference::PreProcess(
 
 
 
-    // call
+    // call, the resized image goes straight into the model input
     DvppProcess dvpp_resize_img(resize_para);
     DvppVpcOutput dvpp_output;
     int ret = dvpp_resize_img.DvppBasicVpcProc(image_handle->org_img.data.get(),
-                                                img_size, &dvpp_output);
+                                                img_size, output_buf,
+                                                output_size, &dvpp_output);
     if (ret != kDvppOperationOk) {
         HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
                         "call ez_dvpp failed, failed to resize image.");
         return false;
     }
-
-    // call success, set data and size
-    resized_image.data.reset(dvpp_output.buffer, default_delete<u_int8_t[]>());
-    resized_image.size = dvpp_output.size;
     return true;
 }
 
-bool face_detection_inference::Inference(
-  const ImageData<u_int8_t> &resized_image,
-  vector<shared_ptr<hiai::IAITensor>> &output_data_vec) {
-  // neural buffer
-  shared_ptr<hiai::AINeuralNetworkBuffer> neural_buf = shared_ptr <
-      hiai::AINeuralNetworkBuffer > (
-        new hiai::AINeuralNetworkBuffer(),
-        default_delete<hiai::AINeuralNetworkBuffer>());
-  neural_buf->SetBuffer((void*) resized_image.data.get(), resized_image.size);
-
-  // input data
-  shared_ptr<hiai::IAITensor> input_data = static_pointer_cast<hiai::IAITensor>(
-        neural_buf);
-  vector<shared_ptr<hiai::IAITensor>> input_data_vec;
-  input_data_vec.push_back(input_data);
-
-  // Call Process
-  // 1. create output tensor
-  hiai::AIContext ai_context;
-  hiai::AIStatus ret = ai_model_manager_->CreateOutputTensor(input_data_vec,
-                       output_data_vec);
-  // create failed
-  if (ret != hiai::SUCCESS) {
-    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                    "call CreateOutputTensor failed");
-    return false;
-  }
+bool face_detection_inference::DetectionPreProcessor::PreProcess(
+  DetectionContext &context, int32_t index, uint8_t *slot) {
+  // the resized image is written into the input tensor of the stage
+  return context.engine->PreProcess(context.image_handle, slot, kItemSize,
+                                    context.roi);
+}
 
-  // 2. process
-  HIAI_ENGINE_LOG("aiModelManager->Process start!");
-  ret = ai_model_manager_->Process(ai_context, input_data_vec, output_data_vec,
-                                   AI_MODEL_PROCESS_TIMEOUT);
-  // process failed, also need to send data to post process
-  if (ret != hiai::SUCCESS) {
-    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT, "call Process failed");
-    return false;
-  }
-  HIAI_ENGINE_LOG("aiModelManager->Process end!");
-  return true;
+bool face_detection_inference::DetectionPostProcessor::PostProcess(
+  DetectionContext &context, int32_t index, int32_t slot,
+  const vector<shared_ptr<hiai::IAITensor>> &output_data_vec) {
+  return context.engine->PostProcess(context.image_handle, output_data_vec,
+                                     context.roi);
 }
 
 bool face_detection_inference::PostProcess(
   shared_ptr<FaceRecognitionInfo> &image_handle,
-  const vector<shared_ptr<hiai::IAITensor>> &output_data_vec) {
+  const vector<shared_ptr<hiai::IAITensor>> &output_data_vec,
+  const DetectionRoi &roi) {
     // inference result vector only need get first result
     // because batch is fixed as 1
     shared_ptr<hiai::AISimpleTensor> result_tensor = static_pointer_cast <
@@ -279,8 +341,9 @@ bool face_detection_inference::PostProcess(
         return false;
     }
 
-    uint32_t width = image_handle->org_img.width;
-    uint32_t height = image_handle->org_img.height;
+    // results are ratio of the roi, map them back to original image
+    uint32_t width = roi.right - roi.left + 1;
+    uint32_t height = roi.down - roi.up + 1;
 
     // every inference result needs 8 float
     // loop the result for every result
@@ -294,10 +357,14 @@ bool face_detection_inference::PostProcess(
 
         // position 矩形框的角标位置点
         FaceRectangle rectangle;
-        rectangle.lt.x = CorrectionRatio(ptr[kLeftTopXaxisIndex]) * width;
-        rectangle.lt.y = CorrectionRatio(ptr[kLeftTopYaxisIndex]) * height;
-        rectangle.rb.x = CorrectionRatio(ptr[kRightBottomXaxisIndex]) * width;
-        rectangle.rb.y = CorrectionRatio(ptr[kRightBottomYaxisIndex]) * height;
+        rectangle.lt.x = roi.left
+            + CorrectionRatio(ptr[kLeftTopXaxisIndex]) * width;
+        rectangle.lt.y = roi.up
+            + CorrectionRatio(ptr[kLeftTopYaxisIndex]) * height;
+        rectangle.rb.x = roi.left
+            + CorrectionRatio(ptr[kRightBottomXaxisIndex]) * width;
+        rectangle.rb.y = roi.up
+            + CorrectionRatio(ptr[kRightBottomYaxisIndex]) * height;
 
 	/*
         // 头部姿势识别，需要将角标放大一些
@@ -343,6 +410,56 @@ bool face_detection_inference::PostProcess(
     return true;
 }
 
+bool face_detection_inference::BuildPyramid(
+  shared_ptr<FaceRecognitionInfo> &image_handle) {
+  const ImageData<u_int8_t> &org_img = image_handle->org_img;
+  for (int32_t level = 0; level < pyramid_levels_; ++level) {
+    // every level is half of the previous one (need even number)
+    uint32_t shift = level + 1;
+    uint32_t level_width = ((org_img.width >> shift) >> 1) << 1;
+    uint32_t level_height = ((org_img.height >> shift) >> 1) << 1;
+    if ((level_width == 0) || (level_height == 0)) {
+      break;
+    }
+
+    // all levels are resized from original image, no crop
+    DvppBasicVpcPara resize_para;
+    resize_para.input_image_type = image_handle->frame.org_img_format;
+    resize_para.src_resolution.width = org_img.width;
+    resize_para.src_resolution.height = org_img.height;
+    resize_para.crop_left = 0;
+    resize_para.crop_up = 0;
+    resize_para.crop_right = ((org_img.width >> 1) << 1) - 1;
+    resize_para.crop_down = ((org_img.height >> 1) << 1) - 1;
+    resize_para.dest_resolution.width = level_width;
+    resize_para.dest_resolution.height = level_height;
+    resize_para.is_input_align = image_handle->frame.img_aligned;
+    // levels are cropped later like the other face images, keep them compact
+    resize_para.is_output_align = false;
+
+    DvppProcess dvpp_resize_img(resize_para);
+    DvppVpcOutput dvpp_output;
+    int ret = dvpp_resize_img.DvppBasicVpcProc(org_img.data.get(),
+                                               org_img.size, &dvpp_output);
+    if (ret != kDvppOperationOk) {
+      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                      "call ez_dvpp failed, failed to build pyramid level %d.",
+                      level);
+      image_handle->pyramid.clear();
+      return false;
+    }
+
+    ImageData<u_int8_t> level_img;
+    level_img.format = org_img.format;
+    level_img.width = level_width;
+    level_img.height = level_height;
+    level_img.size = dvpp_output.size;
+    level_img.data.reset(dvpp_output.buffer, default_delete<u_int8_t[]>());
+    image_handle->pyramid.push_back(level_img);
+  }
+  return true;
+}
+
 void face_detection_inference::HandleErrors(
   AppErrorCode err_code, const string &err_msg,
   shared_ptr<FaceRecognitionInfo> &image_handle) {
@@ -359,25 +476,49 @@ void face_detection_inference::HandleErrors(
 
 void face_detection_inference::SendResult(
   const shared_ptr<FaceRecognitionInfo> &image_handle) {
+  // frames without face (including failed ones) need no landmark,
+  // send them to post process directly
+  uint32_t port = image_handle->face_imgs.empty() ?
+      kNoFaceDataPort : kSendDataPort;
+
+  // post process runs on the host, only the JPEG crosses to it
+  if (port == kNoFaceDataPort) {
+    EncodeOriginalImage(device_jpeg_quality_, *image_handle);
+  }
 
   // when register face, can not discard when queue full
-  HIAI_StatusT hiai_ret;
-  do {
-    hiai_ret = SendData(kSendDataPort, "FaceRecognitionInfo",
-                        static_pointer_cast<void>(image_handle));
-    // when queue full, sleep
-    if (hiai_ret == HIAI_QUEUE_FULL) {
-      HIAI_ENGINE_LOG("queue full, sleep 200ms");
-      usleep(kSleepInterval);
-    }
-  } while (hiai_ret == HIAI_QUEUE_FULL
-           && image_handle->frame.image_source == kRegisterSrc);
+  SendDataWithRetry(this, port, image_handle,
+                    image_handle->frame.image_source == kRegisterSrc,
+                    kSleepInterval);
+}
 
-  // send failed
-  if (hiai_ret != HIAI_OK) {
-    HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
-                    "call SendData failed, err_code=%d", hiai_ret);
+bool face_detection_inference::WarmUp() {
+  if (stage_.warm_up_times() == 0) {
+    return true;
+  }
+
+  shared_ptr<FaceRecognitionInfo> image_handle = CreateWarmUpFrame();
+  if (image_handle == nullptr) {
+    return false;
   }
+
+  for (int32_t i = 0; i < stage_.warm_up_times(); ++i) {
+    DetectionContext context;
+    context.engine = this;
+    context.image_handle = image_handle;
+    if (stage_.Run(context, 1) != StageResult::kOk) {
+      HIAI_ENGINE_LOG(HIAI_ENGINE_RUN_ARGS_NOT_RIGHT,
+                      "face_detection warm-up failed.");
+      return false;
+    }
+    BuildPyramid(image_handle);
+    image_handle->face_imgs.clear();
+    image_handle->pyramid.clear();
+  }
+
+  // warm-up is not part of the running timing
+  stage_.ResetStats();
+  return true;
 }
 
 HIAI_StatusT face_detection_inference::Detection(
@@ -392,27 +533,27 @@ HIAI_StatusT face_detection_inference::Detection(
     return HIAI_ERROR;
   }
 
-  // resize image
-  ImageData<u_int8_t> resized_image;
-  if (!PreProcess(image_handle, resized_image)) {
-    err_msg = "face_detection call ez_dvpp to resize image failed.";
+  // resize image, inference and post process
+  DetectionContext context;
+  context.engine = this;
+  context.image_handle = image_handle;
+  StageResult stage_ret = stage_.Run(context, 1);
+  if (stage_ret != StageResult::kOk) {
+    if (stage_ret == StageResult::kPreProcessFailed) {
+      err_msg = "face_detection call ez_dvpp to resize image failed.";
+    } else if (stage_ret == StageResult::kInferenceFailed) {
+      err_msg = "face_detection inference failed.";
+    } else {
+      err_msg = "face_detection deal result failed.";
+    }
     HandleErrors(AppErrorCode::kDetection, err_msg, image_handle);
     return HIAI_ERROR;
   }
 
-  // inference
-  vector<shared_ptr<hiai::IAITensor>> output_data;
-  if (!Inference(resized_image, output_data)) {
-    err_msg = "face_detection inference failed.";
-    HandleErrors(AppErrorCode::kDetection, err_msg, image_handle);
-    return HIAI_ERROR;
-  }
-
-  // post process
-  if (!PostProcess(image_handle, output_data)) {
-    err_msg = "face_detection deal result failed.";
-    HandleErrors(AppErrorCode::kDetection, err_msg, image_handle);
-    return HIAI_ERROR;
+  // faces are cropped from the pyramid, no face no need to build it.
+  // when failed, later engine crops from original image
+  if (!image_handle->face_imgs.empty()) {
+    BuildPyramid(image_handle);
   }
 
   // send result
@@ -431,5 +572,11 @@ HIAI_IMPL_ENGINE_PROCESS("face_detection_inference", face_detection_inference, I
         FaceRecognitionInfo > (arg0);
     ret = Detection(camera_img);
   }
+
+  // deal arg1 (region of interest update)
+  if (arg1 != nullptr) {
+    shared_ptr<DetectionRoi> roi = static_pointer_cast<DetectionRoi>(arg1);
+    UpdateRoi(*roi);
+  }
     return ret;
 }
@@ -8,7 +8,11 @@
 */
 #ifndef face_detection_inference_ENGINE_H_
 #define face_detection_inference_ENGINE_H_
+#include <mutex>
 #include "biopsy_estimate_params.h"
+#include "device_jpeg_encoder.h"
+#include "inference_stage.h"
+#include "startup_timer.h"
 #include "hiaiengine/api.h"
 #include "hiaiengine/ai_model_manager.h"
 #include "hiaiengine/ai_types.h"
@@ -18,9 +22,11 @@
 #include "hiaiengine/ai_tensor.h"
 
 #define INPUT_SIZE 2
-#define OUTPUT_SIZE 1
+#define OUTPUT_SIZE 2
 
-#define AI_MODEL_PROCESS_TIMEOUT 0
+// model need resized image to 300 * 300
+#define RESIZE_WIDTH 300
+#define RESIZE_HEIGHT 300
 
 class face_detection_inference : public hiai::Engine {
 public:
@@ -34,13 +40,77 @@ public:
     */
     HIAI_DEFINE_PROCESS(INPUT_SIZE, OUTPUT_SIZE)
 private:
+    /**
+    * @brief: per invocation data of the detection stage
+    */
+    struct DetectionContext {
+        face_detection_inference *engine;
+        std::shared_ptr<FaceRecognitionInfo> image_handle;
+        DetectionRoi roi;  // region of original image which is resized
+    };
 
-    // cache AI model parameters
-    std::shared_ptr<hiai::AIModelManager> ai_model_manager_;
+    /**
+    * @brief: detection pre-process policy, resized NV12 image (aligned)
+    */
+    struct DetectionPreProcessor {
+        typedef DetectionContext Context;
+        static const uint32_t kItemSize =
+            AlignUp(RESIZE_WIDTH, ascend::utils::kVpcWidthAlign)
+            * AlignUp(RESIZE_HEIGHT, ascend::utils::kVpcHeightAlign)
+            * kNv12SizeMolecule / kNv12SizeDenominator;
+        static bool PreProcess(Context &context, int32_t index, uint8_t *slot);
+    };
+
+    /**
+    * @brief: detection post-process policy
+    */
+    struct DetectionPostProcessor {
+        static bool PostProcess(
+            DetectionContext &context, int32_t index, int32_t slot,
+            const std::vector<std::shared_ptr<hiai::IAITensor>> &output_data_vec);
+    };
+
+    // model execution of the detection model
+    InferenceStage<DetectionPreProcessor, DetectionPostProcessor> stage_;
 
     // confidence : used to check inference result
     float confidence_;
 
+    // detection region of interest, empty means the full frame
+    DetectionRoi roi_;
+
+    // protect roi_, it can be updated at runtime from input port 1
+    std::mutex roi_mutex_;
+
+    // number of down-scaled pyramid levels built for later engines
+    int32_t pyramid_levels_;
+
+    // JPEG quality of frames without face sent to the host, 0 means off
+    int32_t device_jpeg_quality_;
+
+    /**
+    * @brief: parse region of interest, format is "left,up,right,down"
+    * param [in]: value: configured string
+    * param [out]: roi: parsed region
+    * @return: false:invalid, true: valid
+    */
+    bool ParseRoi(const std::string &value, DetectionRoi &roi);
+
+    /**
+    * @brief: set region of interest used by the following frames
+    * param [in]: roi: new region, empty region means the full frame
+    */
+    void UpdateRoi(const DetectionRoi &roi);
+
+    /**
+    * @brief: clip region of interest to image and dvpp crop alignment
+    *         left and up are even, right and down are odd
+    * param [in]: width: original image width
+    * param [in]: height: original image height
+    * @return: region to crop, full frame when roi_ is empty or invalid
+    */
+    DetectionRoi GetEffectiveRoi(uint32_t width, uint32_t height);
+
     /**
     * @brief: check confidence is valid or not
     * param [in]: confidence
@@ -69,31 +139,43 @@ private:
     /**
     * @brief: pre-process
     * param [in]: image_handle: original image
-    * param [out]: resized_image: ez_dvpp output image
+    * param [in]: output_buf: model input slot, ez_dvpp writes the resized
+    *             image straight into it
+    * param [in]: output_size: size of output_buf
+    * param [out]: roi: region of original image which is resized
     * @return: true: success; false: failed
     */
     bool PreProcess(const std::shared_ptr<FaceRecognitionInfo> &image_handle,
-                    hiai::ImageData<u_int8_t> &resized_image);
-
-    /**
-    * @brief: inference
-    * param [in]: resized_image: ez_dvpp output image
-    * param [out]: output_data_vec: inference output
-    * @return: true: success; false: failed
-    */
-    bool Inference(
-        const hiai::ImageData<u_int8_t> &resized_image,
-        std::vector<std::shared_ptr<hiai::IAITensor>> &output_data_vec);
+                    uint8_t *output_buf, uint32_t output_size,
+                    DetectionRoi &roi);
 
     /**
     * @brief: post process
     * param [out]: image_handle: engine transform image
     * param [in]: output_data_vec: inference output
+    * param [in]: roi: region used by pre-process, results are mapped back
+    *              from it to original image
     * @return: true: success; false: failed
     */
     bool PostProcess(
         std::shared_ptr<FaceRecognitionInfo> &image_handle,
-        const std::vector<std::shared_ptr<hiai::IAITensor>> &output_data_vec);
+        const std::vector<std::shared_ptr<hiai::IAITensor>> &output_data_vec,
+        const DetectionRoi &roi);
+
+    /**
+    * @brief: build down-scaled levels of original image once per frame,
+    *         later engines crop faces from the smallest suitable level
+    * param [out]: image_handle: pyramid of engine transform image
+    * @return: true: success; false: failed
+    */
+    bool BuildPyramid(std::shared_ptr<FaceRecognitionInfo> &image_handle);
+
+    /**
+    * @brief: run a synthetic frame through resize, inference, post process
+    *         and pyramid, the result is not sent
+    * @return: true: success; false: failed
+    */
+    bool WarmUp();
 
     /**
     * @brief: face detection
@@ -112,7 +194,8 @@ private:
                         std::shared_ptr<FaceRecognitionInfo> &image_handle);
 
     /**
-    * @brief: send result
+    * @brief: send result, frames with face go to the biopsy engine,
+    *         the others go to post process directly
     * param [out]: image_handle: engine transform image
     */
     void SendResult(const std::shared_ptr<FaceRecognitionInfo> &image_handle);
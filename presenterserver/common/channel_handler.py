@@ -105,6 +105,8 @@ class ChannelHandler():
         self.channel_manager = ChannelManager([])
         self.rectangle_list = None
         self.point_list = None
+        # liveness state decided by the agent, 0 when it does not check
+        self.liveness = 0
         if media_type == "video":
             self.thread_name = "videothread-{}".format(self.channel_name)
             self.heartbeat = time.time()
@@ -160,6 +162,26 @@ class ChannelHandler():
 
         self.heartbeat = time.time()
 
+    def save_results(self, width, height, rectangle_list, point_list):
+        """save results of a frame whose image is not sent, the last image
+        is shown with them. Liveness runs on the results, so web clients
+        are woken up for every frame, not only for every image"""
+        self.width = width
+        self.height = height
+        self.rectangle_list = rectangle_list
+        self.point_list = point_list
+        if self.media_type == "video":
+            self.web_event.set()
+
+        self.heartbeat = time.time()
+
+    def save_liveness(self, liveness):
+        """save liveness state of the last frame"""
+        self.liveness = liveness
+
+    def get_liveness(self):
+        """get liveness state, 0 when the agent does not check it"""
+        return self.liveness
 
     def get_media_type(self):
         """get media_type, support image or video"""
@@ -66,6 +66,8 @@ class Channel():
         self.image = None
         self.rectangle_list = None
         self.point_list = None
+        # browsers watching the channel, reported to presenter agent
+        self.viewer_count = 0
 
 class ChannelManager():
     """manage all the api about channel
@@ -280,6 +282,40 @@ class ChannelManager():
                     return (self.channel_list[i].image, self.channel_list[i].rectangle_list)
             return (None, None)
 
+    def add_viewer(self, channel_name):
+        """
+        a browser starts watching the channel
+        """
+        with self.channel_lock:
+            for i in range(len(self.channel_list)):
+                if self.channel_list[i].channel_name == channel_name:
+                    self.channel_list[i].viewer_count += 1
+                    break
+
+    def remove_viewer(self, channel_name):
+        """
+        a browser stops watching the channel
+        """
+        with self.channel_lock:
+            for i in range(len(self.channel_list)):
+                if self.channel_list[i].channel_name == channel_name:
+                    if self.channel_list[i].viewer_count > 0:
+                        self.channel_list[i].viewer_count -= 1
+                    break
+
+    def get_viewer_count(self, channel_name):
+        """
+        browsers watching the channel, presenter agent skips images
+        when it is 0
+        """
+        with self.channel_lock:
+            for i in range(len(self.channel_list)):
+                if self.channel_list[i].channel_name == channel_name:
+                    return self.channel_list[i].viewer_count
+
+            # channel not exist
+            return 0
+
     def clean_channel_image(self, channel_name):
         """
         when a channel bounding to image type,
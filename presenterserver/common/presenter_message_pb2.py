@@ -20,7 +20,7 @@ DESCRIPTOR = _descriptor.FileDescriptor(
   name='presenter_message.proto',
   package='ascend.presenter.proto',
   syntax='proto3',
-  serialized_pb=_b('\n\x17presenter_message.proto\x12\x16\x61scend.presenter.proto\"l\n\x12OpenChannelRequest\x12\x14\n\x0c\x63hannel_name\x18\x01 \x01(\t\x12@\n\x0c\x63ontent_type\x18\x02 \x01(\x0e\x32*.ascend.presenter.proto.ChannelContentType\"n\n\x13OpenChannelResponse\x12@\n\nerror_code\x18\x01 \x01(\x0e\x32,.ascend.presenter.proto.OpenChannelErrorCode\x12\x15\n\rerror_message\x18\x02 \x01(\t\"\x12\n\x10HeartbeatMessage\"\"\n\nCoordinate\x12\t\n\x01x\x18\x01 \x01(\r\x12\t\n\x01y\x18\x02 \x01(\r\"\x94\x01\n\x0eRectangle_Attr\x12\x34\n\x08left_top\x18\x01 \x01(\x0b\x32\".ascend.presenter.proto.Coordinate\x12\x38\n\x0cright_bottom\x18\x02 \x01(\x0b\x32\".ascend.presenter.proto.Coordinate\x12\x12\n\nlabel_text\x18\x03 \x01(\t\"\xef\x01\n\x13PresentImageRequest\x12\x33\n\x06\x66ormat\x18\x01 \x01(\x0e\x32#.ascend.presenter.proto.ImageFormat\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x0c\n\x04\x64\x61ta\x18\x04 \x01(\x0c\x12>\n\x0erectangle_list\x18\x05 \x03(\x0b\x32&.ascend.presenter.proto.Rectangle_Attr\x12\x36\n\npoint_list\x18\x06 \x03(\x0b\x32\".ascend.presenter.proto.Coordinate\"o\n\x14PresentImageResponse\x12@\n\nerror_code\x18\x01 \x01(\x0e\x32,.ascend.presenter.proto.PresentDataErrorCode\x12\x15\n\rerror_message\x18\x02 \x01(\t*\xa5\x01\n\x14OpenChannelErrorCode\x12\x19\n\x15kOpenChannelErrorNone\x10\x00\x12\"\n\x1ekOpenChannelErrorNoSuchChannel\x10\x01\x12)\n%kOpenChannelErrorChannelAlreadyOpened\x10\x02\x12#\n\x16kOpenChannelErrorOther\x10\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01*P\n\x12\x43hannelContentType\x12\x1c\n\x18kChannelContentTypeImage\x10\x00\x12\x1c\n\x18kChannelContentTypeVideo\x10\x01*#\n\x0bImageFormat\x12\x14\n\x10kImageFormatJpeg\x10\x00*\xa4\x01\n\x14PresentDataErrorCode\x12\x19\n\x15kPresentDataErrorNone\x10\x00\x12$\n kPresentDataErrorUnsupportedType\x10\x01\x12&\n\"kPresentDataErrorUnsupportedFormat\x10\x02\x12#\n\x16kPresentDataErrorOther\x10\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x62\x06proto3')
+  serialized_pb=_b('\n\x17presenter_message.proto\x12\x16\x61scend.presenter.proto\"l\n\x12OpenChannelRequest\x12\x14\n\x0c\x63hannel_name\x18\x01 \x01(\t\x12@\n\x0c\x63ontent_type\x18\x02 \x01(\x0e\x32*.ascend.presenter.proto.ChannelContentType\"n\n\x13OpenChannelResponse\x12@\n\nerror_code\x18\x01 \x01(\x0e\x32,.ascend.presenter.proto.OpenChannelErrorCode\x12\x15\n\rerror_message\x18\x02 \x01(\t\"\x12\n\x10HeartbeatMessage\"\"\n\nCoordinate\x12\t\n\x01x\x18\x01 \x01(\r\x12\t\n\x01y\x18\x02 \x01(\r\"\x94\x01\n\x0eRectangle_Attr\x12\x34\n\x08left_top\x18\x01 \x01(\x0b\x32\".ascend.presenter.proto.Coordinate\x12\x38\n\x0cright_bottom\x18\x02 \x01(\x0b\x32\".ascend.presenter.proto.Coordinate\x12\x12\n\nlabel_text\x18\x03 \x01(\t\"\xbb\x02\n\x13PresentImageRequest\x12\x33\n\x06\x66ormat\x18\x01 \x01(\x0e\x32#.ascend.presenter.proto.ImageFormat\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x0c\n\x04\x64\x61ta\x18\x04 \x01(\x0c\x12>\n\x0erectangle_list\x18\x05 \x03(\x0b\x32&.ascend.presenter.proto.Rectangle_Attr\x12\x36\n\npoint_list\x18\x06 \x03(\x0b\x32\".ascend.presenter.proto.Coordinate\x12\x11\n\tface_data\x18\x07 \x01(\x0c\x12\x37\n\x08liveness\x18\x08 \x01(\x0e\x32%.ascend.presenter.proto.LivenessState\"\x85\x01\n\x14PresentImageResponse\x12@\n\nerror_code\x18\x01 \x01(\x0e\x32,.ascend.presenter.proto.PresentDataErrorCode\x12\x15\n\rerror_message\x18\x02 \x01(\t\x12\x14\n\x0cviewer_count\x18\x03 \x01(\r\"\xfa\x01\n\x15PresentResultsRequest\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12>\n\x0erectangle_list\x18\x05 \x03(\x0b\x32&.ascend.presenter.proto.Rectangle_Attr\x12\x36\n\npoint_list\x18\x06 \x03(\x0b\x32\".ascend.presenter.proto.Coordinate\x12\x11\n\tface_data\x18\x07 \x01(\x0c\x12\x37\n\x08liveness\x18\x08 \x01(\x0e\x32%.ascend.presenter.proto.LivenessState*\xa5\x01\n\x14OpenChannelErrorCode\x12\x19\n\x15kOpenChannelErrorNone\x10\x00\x12\"\n\x1ekOpenChannelErrorNoSuchChannel\x10\x01\x12)\n%kOpenChannelErrorChannelAlreadyOpened\x10\x02\x12#\n\x16kOpenChannelErrorOther\x10\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01*P\n\x12\x43hannelContentType\x12\x1c\n\x18kChannelContentTypeImage\x10\x00\x12\x1c\n\x18kChannelContentTypeVideo\x10\x01*#\n\x0bImageFormat\x12\x14\n\x10kImageFormatJpeg\x10\x00*\xa4\x01\n\x14PresentDataErrorCode\x12\x19\n\x15kPresentDataErrorNone\x10\x00\x12$\n kPresentDataErrorUnsupportedType\x10\x01\x12&\n\"kPresentDataErrorUnsupportedFormat\x10\x02\x12#\n\x16kPresentDataErrorOther\x10\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01*\x91\x01\n\rLivenessState\x12\x11\n\rkLivenessNone\x10\x00\x12\x14\n\x10kLivenessFrontal\x10\x01\x12\x16\n\x12kLivenessMouthOpen\x10\x02\x12\x15\n\x11kLivenessHeadDown\x10\x03\x12\x13\n\x0fkLivenessPassed\x10\x04\x12\x13\n\x0fkLivenessFailed\x10\x05\x62\x06proto3')
 )
 
 _OPENCHANNELERRORCODE = _descriptor.EnumDescriptor(
@@ -48,8 +48,8 @@ _OPENCHANNELERRORCODE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=836,
-  serialized_end=1001,
+  serialized_start=1188,
+  serialized_end=1353,
 )
 _sym_db.RegisterEnumDescriptor(_OPENCHANNELERRORCODE)
 
@@ -71,8 +71,8 @@ _CHANNELCONTENTTYPE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=1003,
-  serialized_end=1083,
+  serialized_start=1355,
+  serialized_end=1435,
 )
 _sym_db.RegisterEnumDescriptor(_CHANNELCONTENTTYPE)
 
@@ -90,8 +90,8 @@ _IMAGEFORMAT = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=1085,
-  serialized_end=1120,
+  serialized_start=1437,
+  serialized_end=1472,
 )
 _sym_db.RegisterEnumDescriptor(_IMAGEFORMAT)
 
@@ -121,12 +121,51 @@ _PRESENTDATAERRORCODE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=1123,
-  serialized_end=1287,
+  serialized_start=1475,
+  serialized_end=1639,
 )
 _sym_db.RegisterEnumDescriptor(_PRESENTDATAERRORCODE)
 
 PresentDataErrorCode = enum_type_wrapper.EnumTypeWrapper(_PRESENTDATAERRORCODE)
+_LIVENESSSTATE = _descriptor.EnumDescriptor(
+  name='LivenessState',
+  full_name='ascend.presenter.proto.LivenessState',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='kLivenessNone', index=0, number=0,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='kLivenessFrontal', index=1, number=1,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='kLivenessMouthOpen', index=2, number=2,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='kLivenessHeadDown', index=3, number=3,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='kLivenessPassed', index=4, number=4,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='kLivenessFailed', index=5, number=5,
+      options=None,
+      type=None),
+  ],
+  containing_type=None,
+  options=None,
+  serialized_start=1642,
+  serialized_end=1787,
+)
+_sym_db.RegisterEnumDescriptor(_LIVENESSSTATE)
+
+LivenessState = enum_type_wrapper.EnumTypeWrapper(_LIVENESSSTATE)
 kOpenChannelErrorNone = 0
 kOpenChannelErrorNoSuchChannel = 1
 kOpenChannelErrorChannelAlreadyOpened = 2
@@ -138,6 +177,12 @@ kPresentDataErrorNone = 0
 kPresentDataErrorUnsupportedType = 1
 kPresentDataErrorUnsupportedFormat = 2
 kPresentDataErrorOther = -1
+kLivenessNone = 0
+kLivenessFrontal = 1
+kLivenessMouthOpen = 2
+kLivenessHeadDown = 3
+kLivenessPassed = 4
+kLivenessFailed = 5
 
 
 
@@ -373,6 +418,20 @@ _PRESENTIMAGEREQUEST = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='face_data', full_name='ascend.presenter.proto.PresentImageRequest.face_data', index=6,
+      number=7, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='liveness', full_name='ascend.presenter.proto.PresentImageRequest.liveness', index=7,
+      number=8, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -386,7 +445,7 @@ _PRESENTIMAGEREQUEST = _descriptor.Descriptor(
   oneofs=[
   ],
   serialized_start=481,
-  serialized_end=720,
+  serialized_end=796,
 )
 
 
@@ -411,6 +470,79 @@ _PRESENTIMAGERESPONSE = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='viewer_count', full_name='ascend.presenter.proto.PresentImageResponse.viewer_count', index=2,
+      number=3, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=799,
+  serialized_end=932,
+)
+
+
+_PRESENTRESULTSREQUEST = _descriptor.Descriptor(
+  name='PresentResultsRequest',
+  full_name='ascend.presenter.proto.PresentResultsRequest',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='width', full_name='ascend.presenter.proto.PresentResultsRequest.width', index=0,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='height', full_name='ascend.presenter.proto.PresentResultsRequest.height', index=1,
+      number=3, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='rectangle_list', full_name='ascend.presenter.proto.PresentResultsRequest.rectangle_list', index=2,
+      number=5, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='point_list', full_name='ascend.presenter.proto.PresentResultsRequest.point_list', index=3,
+      number=6, type=11, cpp_type=10, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='face_data', full_name='ascend.presenter.proto.PresentResultsRequest.face_data', index=4,
+      number=7, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='liveness', full_name='ascend.presenter.proto.PresentResultsRequest.liveness', index=5,
+      number=8, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None, file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -423,8 +555,8 @@ _PRESENTIMAGERESPONSE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=722,
-  serialized_end=833,
+  serialized_start=935,
+  serialized_end=1185,
 )
 
 _OPENCHANNELREQUEST.fields_by_name['content_type'].enum_type = _CHANNELCONTENTTYPE
@@ -434,7 +566,11 @@ _RECTANGLE_ATTR.fields_by_name['right_bottom'].message_type = _COORDINATE
 _PRESENTIMAGEREQUEST.fields_by_name['format'].enum_type = _IMAGEFORMAT
 _PRESENTIMAGEREQUEST.fields_by_name['rectangle_list'].message_type = _RECTANGLE_ATTR
 _PRESENTIMAGEREQUEST.fields_by_name['point_list'].message_type = _COORDINATE
+_PRESENTIMAGEREQUEST.fields_by_name['liveness'].enum_type = _LIVENESSSTATE
 _PRESENTIMAGERESPONSE.fields_by_name['error_code'].enum_type = _PRESENTDATAERRORCODE
+_PRESENTRESULTSREQUEST.fields_by_name['rectangle_list'].message_type = _RECTANGLE_ATTR
+_PRESENTRESULTSREQUEST.fields_by_name['point_list'].message_type = _COORDINATE
+_PRESENTRESULTSREQUEST.fields_by_name['liveness'].enum_type = _LIVENESSSTATE
 DESCRIPTOR.message_types_by_name['OpenChannelRequest'] = _OPENCHANNELREQUEST
 DESCRIPTOR.message_types_by_name['OpenChannelResponse'] = _OPENCHANNELRESPONSE
 DESCRIPTOR.message_types_by_name['HeartbeatMessage'] = _HEARTBEATMESSAGE
@@ -442,10 +578,12 @@ DESCRIPTOR.message_types_by_name['Coordinate'] = _COORDINATE
 DESCRIPTOR.message_types_by_name['Rectangle_Attr'] = _RECTANGLE_ATTR
 DESCRIPTOR.message_types_by_name['PresentImageRequest'] = _PRESENTIMAGEREQUEST
 DESCRIPTOR.message_types_by_name['PresentImageResponse'] = _PRESENTIMAGERESPONSE
+DESCRIPTOR.message_types_by_name['PresentResultsRequest'] = _PRESENTRESULTSREQUEST
 DESCRIPTOR.enum_types_by_name['OpenChannelErrorCode'] = _OPENCHANNELERRORCODE
 DESCRIPTOR.enum_types_by_name['ChannelContentType'] = _CHANNELCONTENTTYPE
 DESCRIPTOR.enum_types_by_name['ImageFormat'] = _IMAGEFORMAT
 DESCRIPTOR.enum_types_by_name['PresentDataErrorCode'] = _PRESENTDATAERRORCODE
+DESCRIPTOR.enum_types_by_name['LivenessState'] = _LIVENESSSTATE
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
 
 OpenChannelRequest = _reflection.GeneratedProtocolMessageType('OpenChannelRequest', (_message.Message,), dict(
@@ -497,5 +635,12 @@ PresentImageResponse = _reflection.GeneratedProtocolMessageType('PresentImageRes
   ))
 _sym_db.RegisterMessage(PresentImageResponse)
 
+PresentResultsRequest = _reflection.GeneratedProtocolMessageType('PresentResultsRequest', (_message.Message,), dict(
+  DESCRIPTOR = _PRESENTRESULTSREQUEST,
+  __module__ = 'presenter_message_pb2'
+  # @@protoc_insertion_point(class_scope:ascend.presenter.proto.PresentResultsRequest)
+  ))
+_sym_db.RegisterMessage(PresentResultsRequest)
+
 
 # @@protoc_insertion_point(module_scope)
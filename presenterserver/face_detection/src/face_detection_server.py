@@ -33,6 +33,7 @@
 """presenter socket server module"""
 
 import os
+import struct
 import logging
 from logging.config import fileConfig
 from google.protobuf.message import DecodeError
@@ -41,6 +42,10 @@ from common.channel_manager import ChannelManager
 from common.presenter_socket_server import PresenterSocketServer
 from face_detection.src.config_parser import ConfigParser
 
+# layout of face_data of the requests, see presenter_message.proto
+FACE_DATA_HEADER = struct.Struct("<HH")
+FACE_DATA_FACE = struct.Struct("<4h3f")
+
 class FaceDetectionServer(PresenterSocketServer):
     '''A server for face detection'''
     def __init__(self, server_address):
@@ -84,6 +89,9 @@ class FaceDetectionServer(PresenterSocketServer):
         # process image request, receive an image data from presenter agent
         elif msg_name == pb2._PRESENTIMAGEREQUEST.full_name:
             ret = self._process_image_request(conn, msg_data)
+        # process results request, results of a frame whose image is not sent
+        elif msg_name == pb2._PRESENTRESULTSREQUEST.full_name:
+            ret = self._process_results_request(conn, msg_data)
         # process heartbeat request, it used to keepalive a channel path
         elif msg_name == pb2._HEARTBEATMESSAGE.full_name:
             ret = self._process_heartbeat(conn)
@@ -113,6 +121,8 @@ class FaceDetectionServer(PresenterSocketServer):
         |-------------------------------------------------------------------
         |error_message    |    string        |    xx bytes                 |
         |-------------------------------------------------------------------
+        |viewer_count     |    uint32        |    browsers of the channel  |
+        |-------------------------------------------------------------------
 
         enum PresentDataErrorCode {
             kPresentDataErrorNone = 0;
@@ -185,29 +195,122 @@ class FaceDetectionServer(PresenterSocketServer):
             err_code = pb2.kPresentDataErrorUnsupportedFormat
             return self._response_image_request(conn, response, err_code)
 
-        rectangle_list = []
-        point_list = []
-        if request.rectangle_list:
-            for one_rectangle in request.rectangle_list:
-                rectangle = []
-                rectangle.append(one_rectangle.left_top.x)
-                rectangle.append(one_rectangle.left_top.y)
-                rectangle.append(one_rectangle.right_bottom.x)
-                rectangle.append(one_rectangle.right_bottom.y)
-                rectangle.append(one_rectangle.label_text)
-                # add the detection result to list
-                rectangle_list.append(rectangle)
-        if request.point_list:
-            for one_point in request.point_list:
-                point = []
-                point.append(one_point.x)
-                point.append(one_point.y)
-                # add the detection result to list
-                point_list.append(point)
+        rectangle_list, point_list = self._parse_results(request)
+        handler.save_liveness(request.liveness)
         handler.save_image(request.data, request.width, request.height, rectangle_list, point_list)
+        response.viewer_count = self.channel_manager.get_viewer_count(
+            handler.channel_name)
         return self._response_image_request(conn, response,
                                             pb2.kPresentDataErrorNone)
 
+    def _process_results_request(self, conn, msg_data):
+        """
+        Deserialization protobuf and process results_request, the results
+        of a frame whose image is not sent. It is answered by
+        PresentImageResponse, same as an image_request
+        Args:
+            conn: a socket connection
+            msg_data: a protobuf struct, include results request.
+
+        Returns:
+
+        protobuf structure like this:
+         ----------------------------------------------
+        |width             |    uint32                 |
+        |----------------------------------------------
+        |height            |    uint32                 |
+        |----------------------------------------------
+        |rectangle_list    |    repeated Rectangle_Attr|
+        |----------------------------------------------
+        |point_list        |    repeated Coordinate    |
+        |----------------------------------------------
+        |face_data         |    bytes                  |
+        |----------------------------------------------
+        |liveness          |    LivenessState          |
+         ----------------------------------------------
+        """
+        request = pb2.PresentResultsRequest()
+        response = pb2.PresentImageResponse()
+
+        try:
+            request.ParseFromString(msg_data)
+        except DecodeError:
+            logging.error("ParseFromString exception: Error parsing message")
+            err_code = pb2.kPresentDataErrorOther
+            return self._response_image_request(conn, response, err_code)
+
+        handler = self.channel_manager.get_channel_handler_by_fd(conn.fileno())
+        if handler is None:
+            logging.error("get channel handler failed")
+            err_code = pb2.kPresentDataErrorOther
+            return self._response_image_request(conn, response, err_code)
+
+        rectangle_list, point_list = self._parse_results(request)
+        handler.save_liveness(request.liveness)
+        handler.save_results(request.width, request.height, rectangle_list,
+                             point_list)
+        response.viewer_count = self.channel_manager.get_viewer_count(
+            handler.channel_name)
+        return self._response_image_request(conn, response,
+                                            pb2.kPresentDataErrorNone)
+
+    @staticmethod
+    def _parse_results(request):
+        """
+        Convert the rectangles and landmark points of an image_request or a
+        results_request to lists
+        Returns:
+            rectangle_list: [left_top.x, left_top.y, right_bottom.x,
+                             right_bottom.y, label_text] of every rectangle
+            point_list: [x, y] of every point
+        """
+        if request.face_data:
+            return FaceDetectionServer._parse_face_data(request.face_data)
+        rectangle_list = []
+        point_list = []
+        for one_rectangle in request.rectangle_list:
+            rectangle = []
+            rectangle.append(one_rectangle.left_top.x)
+            rectangle.append(one_rectangle.left_top.y)
+            rectangle.append(one_rectangle.right_bottom.x)
+            rectangle.append(one_rectangle.right_bottom.y)
+            rectangle.append(one_rectangle.label_text)
+            # add the detection result to list
+            rectangle_list.append(rectangle)
+        for one_point in request.point_list:
+            point = []
+            point.append(one_point.x)
+            point.append(one_point.y)
+            # add the detection result to list
+            point_list.append(point)
+        return rectangle_list, point_list
+
+    @staticmethod
+    def _parse_face_data(face_data):
+        """
+        Unpack the faces of face_data to the lists of _parse_results. The
+        label of a rectangle is the head pose "pitch:..,yaw:..,roll:.." and
+        the landmark points of all faces follow each other in point_list
+        """
+        rectangle_list = []
+        point_list = []
+        try:
+            face_num, landmark_num = FACE_DATA_HEADER.unpack_from(face_data)
+            points = struct.Struct("<%dh" % (landmark_num * 2))
+            offset = FACE_DATA_HEADER.size
+            for _ in range(face_num):
+                face = FACE_DATA_FACE.unpack_from(face_data, offset)
+                offset += FACE_DATA_FACE.size
+                coordinates = points.unpack_from(face_data, offset)
+                offset += points.size
+                label = "pitch:%f,yaw:%f,roll:%f" % face[4:]
+                rectangle_list.append(list(face[:4]) + [label])
+                point_list.extend([list(coordinates[i:i + 2])
+                                   for i in range(0, len(coordinates), 2)])
+        except struct.error:
+            logging.error("face data of %d bytes is truncated", len(face_data))
+        return rectangle_list, point_list
+
     def stop_thread(self):
         channel_manager = ChannelManager([])
         channel_manager.close_all_thread()
@@ -48,6 +48,16 @@ import tornado.websocket
 import face_detection.src.config_parser as config_parser
 from face_detection.src.antispoofing import *
 from common.channel_manager import ChannelManager
+import common.presenter_message_pb2 as pb2
+
+# liveness state of the agent to the step and answer of antispoof
+LIVENESS_STEPS = {
+    pb2.kLivenessFrontal: (0, 0),
+    pb2.kLivenessMouthOpen: (1, 0),
+    pb2.kLivenessHeadDown: (2, 0),
+    pb2.kLivenessPassed: (3, 1),
+    pb2.kLivenessFailed: (3, -1),
+}
 
 class WebApp:
     """
@@ -278,12 +288,17 @@ class WebApp:
                     print ("")
                 '''
             status = "loading"
-            if len(point_list) == 0:
-                self.anti.down()
+            liveness = handler.get_liveness()
+            if liveness in LIVENESS_STEPS:
+                # the agent runs the challenge on every frame
+                st, ans = LIVENESS_STEPS[liveness]
             else:
-                self.anti.update(point_list,rectangle_list[0][4])
-            st = self.anti.get_st()
-            ans = self.anti.get_ans()
+                if len(point_list) == 0:
+                    self.anti.down()
+                else:
+                    self.anti.update(point_list,rectangle_list[0][4])
+                st = self.anti.get_st()
+                ans = self.anti.get_ans()
             print(st, ans)
             st = st % 4
             if st == 0:
@@ -390,6 +405,11 @@ class WebSocket(tornado.websocket.WebSocketHandler):
         # check request valid or not.
         if not G_WEBAPP.has_request((self.req_id, self.channel_name)):
             self.close()
+            return
+
+        # presenter agent sends images only while someone is watching
+        self.is_viewer = True
+        G_WEBAPP.channel_mgr.add_viewer(self.channel_name)
 
 
     @staticmethod
@@ -416,6 +436,9 @@ class WebSocket(tornado.websocket.WebSocketHandler):
         """
         called when closed web socket
         """
+        if getattr(self, "is_viewer", False):
+            self.is_viewer = False
+            G_WEBAPP.channel_mgr.remove_viewer(self.channel_name)
 
     @tornado.web.asynchronous
     @tornado.gen.coroutine
@@ -0,0 +1,117 @@
+#   =======================================================================
+#
+# Copyright (C) 2018, Hisilicon Technologies Co., Ltd. All Rights Reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#   1 Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#
+#   2 Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+#
+#   3 Neither the names of the copyright holders nor the names of the
+#   contributors may be used to endorse or promote products derived from this
+#   software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#   =======================================================================
+#
+
+"""stand-in presenter server without web ui, it answers presenter agent
+like the face detection server and prints the rate of every message type
+every second. Usage:
+    python3 stub_server.py --ip 0.0.0.0 --port 7006 [--delay_ms 0]
+                           [--viewers 1]
+"""
+
+import sys
+import time
+import signal
+import argparse
+import logging
+import threading
+
+from face_detection.src.face_detection_server import FaceDetectionServer
+
+# print the rates every N seconds
+REPORT_INTERVAL = 1
+
+
+class StubServer(FaceDetectionServer):
+    '''face detection server which counts messages instead of showing them'''
+    def __init__(self, server_address, delay_ms, viewers):
+        '''init func'''
+        self.delay = delay_ms / 1000.0
+        self.counters = {}
+        self.counter_lock = threading.Lock()
+        super(StubServer, self).__init__(server_address)
+        # there is no browser, every channel reports the given viewers
+        self.channel_manager.get_viewer_count = lambda channel_name: viewers
+
+    def _process_msg(self, conn, msg_name, msg_data):
+        """count the message, then process it like the face detection server.
+        An image is answered after delay_ms to emulate a slow link"""
+        short_name = msg_name.split(".")[-1]
+        with self.counter_lock:
+            count, size = self.counters.get(short_name, (0, 0))
+            self.counters[short_name] = (count + 1, size + len(msg_data))
+        if self.delay > 0 and short_name == "PresentImageRequest":
+            time.sleep(self.delay)
+        return super(StubServer, self)._process_msg(conn, msg_name, msg_data)
+
+    def report(self):
+        """print messages per second and kbit per second of every type"""
+        while not self.thread_exit_switch:
+            time.sleep(REPORT_INTERVAL)
+            with self.counter_lock:
+                counters = self.counters
+                self.counters = {}
+            line = ", ".join(
+                "%s: %.1f/s %.0f kbps" % (name, count / REPORT_INTERVAL,
+                                          size * 8 / 1000.0 / REPORT_INTERVAL)
+                for name, (count, size) in sorted(counters.items()))
+            print(line if line else "no message")
+
+
+def main():
+    '''Main function entrance'''
+    logging.basicConfig(level=logging.WARNING)
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--ip', type=str, default="0.0.0.0",
+                        help="listen address of presenter agent")
+    parser.add_argument('--port', type=int, default=7006,
+                        help="listen port of presenter agent")
+    parser.add_argument('--delay_ms', type=int, default=0,
+                        help="delay before an image is answered")
+    parser.add_argument('--viewers', type=int, default=1,
+                        help="viewers reported, 0 lets the agent skip images")
+    args = parser.parse_args()
+
+    server = StubServer((args.ip, args.port), args.delay_ms, args.viewers)
+
+    def stop(signum, frame):
+        '''stop the server threads and exit'''
+        logging.info("receive signal, signum:%s, frame:%s", signum, frame)
+        server.stop_thread()
+        sys.exit()
+
+    signal.signal(signal.SIGINT, stop)
+    signal.signal(signal.SIGTERM, stop)
+    server.report()
+
+
+if __name__ == "__main__":
+    main()
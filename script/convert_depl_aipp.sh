@@ -0,0 +1,71 @@
+#!/bin/bash
+#
+#   =======================================================================
+#
+# Copyright (C) 2018, Hisilicon Technologies Co., Ltd. All Rights Reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#   1 Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#
+#   2 Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+#
+#   3 Neither the names of the copyright holders nor the names of the
+#   contributors may be used to endorse or promote products derived from this
+#   software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#   =======================================================================
+
+
+# convert the depl caffe model to depl.om with the AIPP configuration
+# depl_aipp.cfg, the model then takes the NV12 face of VPC as uint8 input.
+# set graph.config item aipp_input of biopsy_inference to "1" to use it.
+# usage: bash convert_depl_aipp.sh depl.prototxt depl.caffemodel
+
+# ************************Variable*********************************************
+script_path="$( cd "$(dirname "$0")" ; pwd -P )"
+
+model_file=$1
+weight_file=$2
+
+main()
+{
+    if [[ ${DDK_HOME}"X" == "X" ]];then
+        echo "ERROR: Please set DDK_HOME to the DDK installation path."
+        exit 1
+    fi
+
+    if [ ! -f "${model_file}" ] || [ ! -f "${weight_file}" ];then
+        echo "ERROR: usage: bash convert_depl_aipp.sh depl.prototxt depl.caffemodel"
+        exit 1
+    fi
+
+    export LD_LIBRARY_PATH=${DDK_HOME}/uihost/lib:${LD_LIBRARY_PATH}
+    # framework 0: caffe, the output is found by prepare_model.sh local mode
+    ${DDK_HOME}/uihost/bin/omg --model=${model_file} --weight=${weight_file} \
+        --framework=0 --output=${script_path}/depl \
+        --insert_op_conf=${script_path}/depl_aipp.cfg
+    if [ $? -ne 0 ];then
+        echo "ERROR: convert depl model with AIPP failed."
+        exit 1
+    fi
+    echo "depl.om with AIPP is generated in ${script_path}."
+    exit 0
+}
+
+main
@@ -76,6 +76,24 @@ public:
     int DvppOperationProc(const char *input_buf, int input_size,
                           DvppOutput *output_data);
 
+    /**
+     * @brief Dvpp change from yuv to jpg into a buffer of the caller, so the
+     *        jpg can go to a pooled buffer without another copy
+     * @param [in] char *input_buf: yuv data buffer
+     * @param [in] int input_size  : size of yuv data buffer
+     * @param [in] unsigned char *output_buf: buffer of the caller, may be
+     *             nullptr
+     * @param [in] unsigned int output_capacity: size of output_buf
+     * @param [out]DvppOutput *output_data :dvpp output buffer and size,
+     *             buffer is output_buf when the jpg fits into it, else a new
+     *             buffer which the caller deletes with delete[]
+     * @return  enum DvppErrorCode
+     */
+    int DvppOperationProc(const char *input_buf, int input_size,
+                          unsigned char *output_buf,
+                          unsigned int output_capacity,
+                          DvppOutput *output_data);
+
     /**
      * @brief Dvpp decode jpeg and change jpeg to yuv
      * @param [in] char *input_buf: jpeg data buffer
@@ -96,6 +114,22 @@ public:
     int DvppBasicVpcProc(const uint8_t *input_buf, int32_t input_size,
                          DvppVpcOutput *output_data);
 
+    /**
+     * @brief Dvpp new vpc interface into a buffer of the caller, so the vpc
+     *        output can go to a model input buffer without another copy
+     * @param [in] uint8_t *input_buf: vpc data buffer
+     * @param [in] int32_t input_size  : size of vpc data buffer
+     * @param [in] uint8_t *output_buf: buffer of the caller
+     * @param [in] int32_t output_capacity: size of output_buf, not less than
+     *             the vpc output size
+     * @param [out]DvppVpcOutput *output_data :buffer is output_buf, size is
+     *             the vpc output size
+     * @return  enum DvppErrorCode
+     */
+    int DvppBasicVpcProc(const uint8_t *input_buf, int32_t input_size,
+                         uint8_t *output_buf, int32_t output_capacity,
+                         DvppVpcOutput *output_data);
+
     /**
      * @brief get a error message according to error code.
      * @param [in] int code: error code.
@@ -128,6 +162,13 @@ private:
      */
     int DvppProc(const sJpegeIn &input_data, sJpegeOut *output_data);
 
+    /**
+     * @brief size of the new vpc output image
+     * @param [out] int32_t &output_size: size of the output image
+     * @return  enum DvppErrorCode
+     */
+    int GetBasicVpcOutputSize(int32_t &output_size) const;
+
     /**
      * @brief new vpc interface, include crop/resize/image format conversion
      * @param [in] input_buf:input image data
@@ -67,42 +67,67 @@ ascend::utils::DvppProcess::~DvppProcess() {
 
 int DvppProcess::DvppOperationProc(const char *input_buf, int input_size,
                                    DvppOutput *output_data) {
-    int ret = kDvppOperationOk;
-
     // yuv change to jpg
     if (convert_mode_ == kJpeg) {
-        sJpegeOut jpg_output_data;
+        return DvppOperationProc(input_buf, input_size, nullptr, 0,
+                                 output_data);
+    }
 
-        // yuv change jpg
-        ret = DvppYuvChangeToJpeg(input_buf, input_size, &jpg_output_data);
-        if (ret != kDvppOperationOk) {
-            return ret;
-        }
+    return kDvppOperationOk;
+}
 
-        // check data size
-        ret = DvppUtils::CheckDataSize(jpg_output_data.jpgSize);
-        if (ret != kDvppOperationOk) {
-            ASC_LOG_ERROR(
-                    "To prevent excessive memory, data size should be in "
-                    "(0, 64]M!, Now data size is %d byte.",
-                    jpg_output_data.jpgSize);
-            return ret;
-        }
+int DvppProcess::DvppOperationProc(const char *input_buf, int input_size,
+                                   unsigned char *output_buf,
+                                   unsigned int output_capacity,
+                                   DvppOutput *output_data) {
+    if ((convert_mode_ != kJpeg) || (output_data == nullptr)) {
+        return kDvppErrorInvalidParameter;
+    }
+
+    // yuv change jpg
+    sJpegeOut jpg_output_data;
+    int ret = DvppYuvChangeToJpeg(input_buf, input_size, &jpg_output_data);
+    if (ret != kDvppOperationOk) {
+        return ret;
+    }
 
-        // new output buffer
-        output_data->buffer = new (nothrow) unsigned char[jpg_output_data
-                .jpgSize];
-        CHECK_NEW_RESULT(output_data->buffer);
+    // check data size
+    ret = DvppUtils::CheckDataSize(jpg_output_data.jpgSize);
+    if (ret != kDvppOperationOk) {
+        ASC_LOG_ERROR(
+                "To prevent excessive memory, data size should be in "
+                "(0, 64]M!, Now data size is %d byte.",
+                jpg_output_data.jpgSize);
+        jpg_output_data.cbFree();
+        return ret;
+    }
 
-        // output the jpg data
-        output_data->size = jpg_output_data.jpgSize;
-        ret = memcpy_s(output_data->buffer, output_data->size,
-                       jpg_output_data.jpgData, jpg_output_data.jpgSize);
+    // the buffer of the caller when the jpg fits, else a new output buffer
+    bool own_buffer = (output_buf == nullptr)
+            || (jpg_output_data.jpgSize > output_capacity);
+    output_data->buffer = own_buffer ?
+            new (nothrow) unsigned char[jpg_output_data.jpgSize] : output_buf;
+    if (output_data->buffer == nullptr) {
         jpg_output_data.cbFree();
-        CHECK_MEMCPY_RESULT(ret, output_data->buffer);  // if error,program exit
+        ASC_LOG_ERROR("Failed to new memory.");
+        return kDvppErrorNewFail;
     }
 
-    return ret;
+    // output the jpg data
+    output_data->size = jpg_output_data.jpgSize;
+    ret = memcpy_s(output_data->buffer, output_data->size,
+                   jpg_output_data.jpgData, jpg_output_data.jpgSize);
+    jpg_output_data.cbFree();
+    if (ret != EOK) {
+        ASC_LOG_ERROR("Failed to copy memory,Ret=%d.", ret);
+        if (own_buffer) {
+            delete[] output_data->buffer;
+        }
+        output_data->buffer = nullptr;
+        return kDvppErrorMemcpyFail;
+    }
+
+    return kDvppOperationOk;
 }
 
 int DvppProcess::DvppJpegDProc(const char *input_buf, int input_size,
@@ -178,10 +203,7 @@ int DvppProcess::DvppJpegDProc(const char *input_buf, int input_size,
     return ret;
 }
 
-int DvppProcess::DvppBasicVpcProc(const uint8_t *input_buf, int32_t input_size,
-                                  DvppVpcOutput *output_data) {
-    int ret = kDvppOperationOk;
-
+int DvppProcess::GetBasicVpcOutputSize(int32_t &output_size) const {
     // set width of dest image
     int dest_width = dvpp_instance_para_.basic_vpc_para.dest_resolution.width;
 
@@ -204,7 +226,7 @@ int DvppProcess::DvppBasicVpcProc(const uint8_t *input_buf, int32_t input_size,
     }
 
     // check data size
-    ret = DvppUtils::CheckDataSize(data_size);
+    int ret = DvppUtils::CheckDataSize(data_size);
     if (ret != kDvppOperationOk) {
         ASC_LOG_ERROR(
                 "To prevent excessive memory, data size should be in (0, 64]M! "
@@ -213,6 +235,18 @@ int DvppProcess::DvppBasicVpcProc(const uint8_t *input_buf, int32_t input_size,
         return ret;
     }
 
+    output_size = data_size;
+    return kDvppOperationOk;
+}
+
+int DvppProcess::DvppBasicVpcProc(const uint8_t *input_buf, int32_t input_size,
+                                  DvppVpcOutput *output_data) {
+    int data_size = 0;
+    int ret = GetBasicVpcOutputSize(data_size);
+    if (ret != kDvppOperationOk) {
+        return ret;
+    }
+
     // create output buffer
     uint8_t *output_buffer = new (nothrow) unsigned char[data_size];
     CHECK_NEW_RESULT(output_buffer);
@@ -231,6 +265,37 @@ int DvppProcess::DvppBasicVpcProc(const uint8_t *input_buf, int32_t input_size,
     return ret;
 }
 
+int DvppProcess::DvppBasicVpcProc(const uint8_t *input_buf, int32_t input_size,
+                                  uint8_t *output_buf, int32_t output_capacity,
+                                  DvppVpcOutput *output_data) {
+    int data_size = 0;
+    int ret = GetBasicVpcOutputSize(data_size);
+    if (ret != kDvppOperationOk) {
+        return ret;
+    }
+
+    // the caller buffer must hold the whole output image
+    if ((output_buf == nullptr) || (output_capacity < data_size)) {
+        ASC_LOG_ERROR(
+                "Output buffer is too small for basic vpc, capacity is %d "
+                "byte, data size is %d byte.",
+                output_capacity, data_size);
+        return kDvppErrorInvalidParameter;
+    }
+
+    //crop or resize image
+    ret = DvppBasicVpc(input_buf, input_size, data_size, output_buf);
+    if (ret != kDvppOperationOk) {
+        return ret;
+    }
+
+    // output the nv12 data
+    output_data->buffer = output_buf;
+    output_data->size = data_size;
+
+    return ret;
+}
+
 int DvppProcess::DvppProc(const sJpegeIn &input_data, sJpegeOut *output_data) {
     if (output_data == nullptr) {
         return kDvppErrorInvalidParameter;
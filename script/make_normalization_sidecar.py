@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+#
+#   =======================================================================
+#
+# Copyright (C) 2018, Hisilicon Technologies Co., Ltd. All Rights Reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#   1 Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#
+#   2 Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+#
+#   3 Neither the names of the copyright holders nor the names of the
+#   contributors may be used to endorse or promote products derived from this
+#   software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#   =======================================================================
+#
+"""write the normalization sidecar of a model, the mean and std of every
+pixel of the model input, loaded by biopsy_inference when normalize is 1
+
+usage:
+    python3 make_normalization_sidecar.py mean std depl.norm
+mean and std are .npy arrays or images (such as trainMean.png), HWC BGR,
+resized to the model input when the size is different. The sidecar is
+placed next to depl.om, prepare_model.sh copies it with the model.
+"""
+import argparse
+import struct
+import sys
+
+import numpy as np
+
+# must be the same as normalization_sidecar.h
+SIDECAR_MAGIC = 0x4D524E42
+SIDECAR_VERSION = 1
+HEADER_FORMAT = "<8I"
+
+
+def load_tensor(path, height, width):
+    """load HWC float data from .npy or image, resized to height x width"""
+    if path.endswith(".npy"):
+        data = np.load(path).astype(np.float32)
+    else:
+        import cv2
+        data = cv2.imread(path, cv2.IMREAD_UNCHANGED)
+        if data is None:
+            raise ValueError("can not read %s" % path)
+        data = data.astype(np.float32)
+    if data.ndim == 2:
+        data = data[:, :, np.newaxis]
+    if data.shape[0] != height or data.shape[1] != width:
+        import cv2
+        print("resize %s from %dx%d to %dx%d" % (path, data.shape[0],
+                                                 data.shape[1], height, width))
+        data = cv2.resize(data, (width, height),
+                          interpolation=cv2.INTER_LINEAR)
+        if data.ndim == 2:
+            data = data[:, :, np.newaxis]
+    return np.ascontiguousarray(data, dtype="<f4")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="make normalization sidecar")
+    parser.add_argument("mean")
+    parser.add_argument("std")
+    parser.add_argument("output")
+    parser.add_argument("--height", type=int, default=224)
+    parser.add_argument("--width", type=int, default=224)
+    parser.add_argument("--channels", type=int, default=3)
+    args = parser.parse_args()
+
+    mean = load_tensor(args.mean, args.height, args.width)
+    std = load_tensor(args.std, args.height, args.width)
+    shape = (args.height, args.width, args.channels)
+    if mean.shape != shape or std.shape != shape:
+        print("ERROR: mean is %s, std is %s, model input is %s"
+              % (mean.shape, std.shape, shape))
+        return 1
+    if not np.all(std > 0):
+        print("ERROR: std must be positive")
+        return 1
+
+    with open(args.output, "wb") as sidecar:
+        sidecar.write(struct.pack(HEADER_FORMAT, SIDECAR_MAGIC,
+                                  SIDECAR_VERSION, args.height, args.width,
+                                  args.channels, 0, 0, 0))
+        sidecar.write(mean.tobytes())
+        sidecar.write(std.tobytes())
+    print("%s is generated" % args.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,181 @@
+/*******
+*
+* Copyright(c)<2018>, <Huawei Technologies Co.,Ltd>
+*
+* @version 1.0
+*
+* @date 2018-5-19
+*/
+/*
+ * Benchmark of the fused NV12 to planar BGR float converter of
+ * biopsy_inference against the opencv path it replaced: memcpy into a Mat,
+ * cvtColor(CV_YUV2BGR_NV12), convertTo(CV_32FC3), (x - mean) / std and split.
+ * Both paths convert the same 224x224 NV12 faces, with and without
+ * normalization, and the time per face and the most difference are printed.
+ *
+ * It is no part of the engine, build it in this directory and run it on the
+ * device:
+ *   aarch64-linux-gnu-g++ -O2 -std=c++11 -I../biopsyapp/biopsy_inference \
+ *     -I$DDK_HOME/include/third_party/opencv/include \
+ *     nv12_converter_benchmark.cpp \
+ *     ../biopsyapp/biopsy_inference/nv12_converter.cpp \
+ *     -L$DDK_HOME/device/lib -lopencv_world -o nv12_converter_benchmark
+ *   ./nv12_converter_benchmark [faces]
+ */
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <stdint.h>
+
+#include "opencv2/opencv.hpp"
+#include "opencv2/imgproc.hpp"
+#include "nv12_converter.h"
+
+namespace {
+// model input of biopsy_inference
+const int32_t kFaceWidth = 224;
+const int32_t kFaceHeight = 224;
+const int32_t kChannels = 3;
+
+// faces converted by each path when no number is given
+const int32_t kDefaultFaces = 1000;
+
+// distinct faces, so that not every conversion reads the same cached input
+const int32_t kFacePoolSize = 16;
+
+typedef std::chrono::steady_clock Clock;
+
+struct BenchmarkResult {
+  double fused_us;  // average time of one face by the fused converter
+  double opencv_us;  // average time of one face by the opencv path
+  float max_diff;  // most difference in pixel levels
+};
+
+/**
+ * @brief: NV12 faces with gradient luma and chroma, which cover the clamp of
+ *         every channel
+ */
+std::vector<std::vector<uint8_t>> MakeFaces() {
+  size_t size = kFaceWidth * kFaceHeight * 3 / 2;
+  std::vector<std::vector<uint8_t>> faces(kFacePoolSize,
+                                          std::vector<uint8_t>(size));
+  for (int32_t face = 0; face < kFacePoolSize; ++face) {
+    for (size_t i = 0; i < size; ++i) {
+      faces[face][i] = static_cast<uint8_t>(i * 7 + i / kFaceWidth + face * 13);
+    }
+  }
+  return faces;
+}
+
+/**
+ * @brief: per-pixel BGR interleaved mean and std, like a normalization
+ *         sidecar
+ */
+void MakeNormalization(std::vector<float> &mean, std::vector<float> &std_dev) {
+  size_t count = kFaceWidth * kFaceHeight * kChannels;
+  mean.resize(count);
+  std_dev.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    mean[i] = 100.0f + (i % 57);
+    std_dev[i] = 40.0f + (i % 23);
+  }
+}
+
+/**
+ * @brief: the converter of biopsy_inference before the fused kernel
+ */
+void OpencvConvert(const uint8_t *nv12, const cv::Mat &mean,
+                   const cv::Mat &std_dev, bool normalize,
+                   std::vector<cv::Mat> &planes) {
+  cv::Mat src(kFaceHeight * 3 / 2, kFaceWidth, CV_8UC1);
+  memcpy(src.data, nv12, kFaceWidth * kFaceHeight * 3 / 2);
+  cv::Mat bgr_u8;
+  cv::cvtColor(src, bgr_u8, CV_YUV2BGR_NV12);
+  cv::Mat bgr;
+  bgr_u8.convertTo(bgr, CV_32FC3);
+  if (normalize) {
+    bgr = bgr - mean;
+    bgr = bgr / std_dev;
+  }
+  cv::split(bgr, planes);
+}
+
+BenchmarkResult Run(const std::vector<std::vector<uint8_t>> &faces,
+                    int32_t face_num, std::vector<float> &mean,
+                    std::vector<float> &std_dev, bool normalize) {
+  const float *mean_data = normalize ? mean.data() : nullptr;
+  const float *std_data = normalize ? std_dev.data() : nullptr;
+  cv::Mat mean_mat(kFaceHeight, kFaceWidth, CV_32FC3, mean.data());
+  cv::Mat std_mat(kFaceHeight, kFaceWidth, CV_32FC3, std_dev.data());
+  int32_t plane_size = kFaceWidth * kFaceHeight;
+  std::vector<float> fused(plane_size * kChannels);
+  std::vector<cv::Mat> planes;
+  BenchmarkResult result;
+
+  // the most difference over every distinct face, a normalized value is
+  // divided by its std, so is its difference
+  result.max_diff = 0;
+  for (int32_t face = 0; face < kFacePoolSize; ++face) {
+    Nv12ToPlanarBgr(faces[face].data(), kFaceWidth, kFaceHeight, kFaceWidth,
+                    mean_data, std_data, fused.data());
+    OpencvConvert(faces[face].data(), mean_mat, std_mat, normalize, planes);
+    for (int32_t c = 0; c < kChannels; ++c) {
+      const float *reference = planes[c].ptr<float>(0);
+      for (int32_t i = 0; i < plane_size; ++i) {
+        float scale = normalize ? std::fabs(std_dev[i * kChannels + c]) : 1.0f;
+        float diff =
+            std::fabs(fused[c * plane_size + i] - reference[i]) * scale;
+        result.max_diff = (diff > result.max_diff) ? diff : result.max_diff;
+      }
+    }
+  }
+
+  Clock::time_point begin = Clock::now();
+  for (int32_t face = 0; face < face_num; ++face) {
+    Nv12ToPlanarBgr(faces[face % kFacePoolSize].data(), kFaceWidth,
+                    kFaceHeight, kFaceWidth, mean_data, std_data,
+                    fused.data());
+  }
+  Clock::time_point end = Clock::now();
+  result.fused_us = std::chrono::duration<double, std::micro>(
+      end - begin).count() / face_num;
+
+  begin = Clock::now();
+  for (int32_t face = 0; face < face_num; ++face) {
+    OpencvConvert(faces[face % kFacePoolSize].data(), mean_mat, std_mat,
+                  normalize, planes);
+  }
+  end = Clock::now();
+  result.opencv_us = std::chrono::duration<double, std::micro>(
+      end - begin).count() / face_num;
+  return result;
+}
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  int32_t face_num = (argc > 1) ? atoi(argv[1]) : kDefaultFaces;
+  if (face_num <= 0) {
+    fprintf(stderr, "usage: %s [faces]\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<std::vector<uint8_t>> faces = MakeFaces();
+  std::vector<float> mean;
+  std::vector<float> std_dev;
+  MakeNormalization(mean, std_dev);
+
+  printf("%d faces of %dx%d NV12\n", face_num, kFaceWidth, kFaceHeight);
+  printf("%-10s %12s %12s %9s %10s\n", "normalize", "fused us", "opencv us",
+         "speedup", "max diff");
+  const bool normalize_modes[] = { false, true };
+  for (bool normalize : normalize_modes) {
+    BenchmarkResult result = Run(faces, face_num, mean, std_dev, normalize);
+    printf("%-10s %12.2f %12.2f %8.2fx %10.4f\n", normalize ? "yes" : "no",
+           result.fused_us, result.opencv_us,
+           result.opencv_us / result.fused_us, result.max_diff);
+  }
+  return 0;
+}
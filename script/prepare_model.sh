@@ -71,6 +71,10 @@ function prepare()
             else
                 mkdir -p ${app_path}/MyModel/${model_name}/device
                 cp ${script_path}/${model_name}.om ${app_path}/MyModel/${model_name}/device/
+                # normalization sidecar of the model, see make_normalization_sidecar.py
+                if [ -f "${script_path}/${model_name}.norm" ];then
+                    cp ${script_path}/${model_name}.norm ${app_path}/MyModel/${model_name}/device/
+                fi
             fi
         done
     else
@@ -90,6 +94,9 @@ function prepare()
             model_name=`basename ${model_info}`
             mkdir -p ${app_path}/MyModel/${model_name}/device
             cp ${script_path}/${model_name}_${tools_version}.om ${app_path}/MyModel/${model_name}/device/${model_name}.om
+            if [ -f "${script_path}/${model_name}.norm" ];then
+                cp ${script_path}/${model_name}.norm ${app_path}/MyModel/${model_name}/device/
+            fi
         done
 
     fi
@@ -60,6 +60,39 @@ PresenterErrorCode OpenChannel(Channel *&channel,
  */
 PresenterErrorCode PresentImage(Channel *channel, const ImageFrame &image);
 
+/**
+ * @brief Send the image to server for display through the given channel, and
+ *        get how many browsers are watching the channel
+ * @param [in] channel        the channel to send the image with
+ * @param [in] image          the image to display
+ * @param [out] viewer_count  browsers watching the channel, always 0 when
+ *                            the server does not report it
+ * @return PresenterErrorCode
+ */
+PresenterErrorCode PresentImage(Channel *channel, const ImageFrame &image,
+                                uint32_t &viewer_count);
+
+/**
+ * @brief Send only the detection results of an image to server, for the
+ *        frames whose image is not sent. The image data is ignored
+ * @param [in] channel        the channel to send the results with
+ * @param [in] image          width, height and detection results
+ * @return PresenterErrorCode
+ */
+PresenterErrorCode PresentResults(Channel *channel, const ImageFrame &image);
+
+/**
+ * @brief Send only the detection results of an image to server, and get how
+ *        many browsers are watching the channel
+ * @param [in] channel        the channel to send the results with
+ * @param [in] image          width, height and detection results
+ * @param [out] viewer_count  browsers watching the channel, always 0 when
+ *                            the server does not report it
+ * @return PresenterErrorCode
+ */
+PresenterErrorCode PresentResults(Channel *channel, const ImageFrame &image,
+                                  uint32_t &viewer_count);
+
 /**
  * @brief Send the image message to server for display through the given channel
  * @param [in] channel        the channel to send the image with
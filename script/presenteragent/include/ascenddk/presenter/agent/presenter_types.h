@@ -65,6 +65,28 @@ enum class ImageFormat {
   kReserved = 127,
 };
 
+/**
+ * LivenessState
+ * step of the liveness challenge decided by the agent
+ */
+enum class LivenessState {
+  // liveness is not checked
+  kNone = 0,
+
+  // waiting for a frontal face
+  kFrontal = 1,
+
+  // waiting for an open mouth
+  kMouthOpen = 2,
+
+  // waiting for the head down
+  kHeadDown = 3,
+
+  // challenge passed or failed
+  kPassed = 4,
+  kFailed = 5,
+};
+
 /**
  * OpenChannelParam
  */
@@ -84,9 +106,24 @@ struct DetectionResult {
     Point lt;   //The coordinate of left top point
     Point rb;   //The coordinate of the right bottom point
     std::string result_text;  // Face:xx%
+    std::vector<Point> points;  // landmark points of the result, may be empty
+};
+
+/**
+ * FaceResult
+ * a face sent in the packed face_data of the request, coordinates beyond
+ * 32767 are clamped
+ */
+struct FaceResult {
+    Point lt;   //The coordinate of left top point
+    Point rb;   //The coordinate of the right bottom point
+    float pose[3];  // pitch, yaw, roll
+    std::vector<Point> landmarks;  // the same number for every face
 };
 /**
  * ImageFrame
+ * data is sent as it is after the message, it is not copied. size 0 sends
+ * the detection results without image
  */
 struct ImageFrame {
   ImageFormat format;
@@ -95,6 +132,8 @@ struct ImageFrame {
   std::uint32_t size;
   unsigned char *data;
   std::vector<DetectionResult> detection_results;
+  std::vector<FaceResult> face_results;  // sent packed when not empty
+  LivenessState liveness = LivenessState::kNone;
 };
 
 } /* namespace presenter */
@@ -115,6 +115,12 @@ PresenterErrorCode OpenChannel(Channel *&channel,
 }
 
 PresenterErrorCode PresentImage(Channel *channel, const ImageFrame &image) {
+  uint32_t viewer_count = 0;
+  return PresentImage(channel, image, viewer_count);
+}
+
+PresenterErrorCode PresentImage(Channel *channel, const ImageFrame &image,
+                                uint32_t &viewer_count) {
   if (channel == nullptr) {
     AGENT_LOG_ERROR("channel is NULL");
     return PresenterErrorCode::kInvalidParam;
@@ -125,14 +131,16 @@ PresenterErrorCode PresentImage(Channel *channel, const ImageFrame &image) {
     return PresenterErrorCode::kInvalidParam;
   }
 
-  Tlv tlv;
-  tlv.tag = proto::PresentImageRequest::kDataFieldNumber;
-  tlv.length = image.size;
-  tlv.value = reinterpret_cast<char *>(image.data);
-
+  // the image is sent from its own buffer, not copied into the message
   PartialMessageWithTlvs message;
   message.message = &req;
-  message.tlv_list.push_back(tlv);
+  if (image.size > 0) {
+    Tlv tlv;
+    tlv.tag = proto::PresentImageRequest::kDataFieldNumber;
+    tlv.length = image.size;
+    tlv.value = reinterpret_cast<char *>(image.data);
+    message.tlv_list.push_back(tlv);
+  }
 
   std::unique_ptr<Message> recv_message;
   PresenterErrorCode error_code = channel->SendMessage(message, recv_message);
@@ -141,7 +149,34 @@ PresenterErrorCode PresentImage(Channel *channel, const ImageFrame &image) {
     return error_code;
   }
 
-  return PresenterMessageHelper::CheckPresentImageResponse(*recv_message);
+  return PresenterMessageHelper::CheckPresentImageResponse(*recv_message,
+                                                           &viewer_count);
+}
+
+PresenterErrorCode PresentResults(Channel *channel, const ImageFrame &image) {
+  uint32_t viewer_count = 0;
+  return PresentResults(channel, image, viewer_count);
+}
+
+PresenterErrorCode PresentResults(Channel *channel, const ImageFrame &image,
+                                  uint32_t &viewer_count) {
+  if (channel == nullptr) {
+    AGENT_LOG_ERROR("channel is NULL");
+    return PresenterErrorCode::kInvalidParam;
+  }
+
+  proto::PresentResultsRequest req;
+  PresenterMessageHelper::InitPresentResultsRequest(req, image);
+
+  std::unique_ptr<Message> recv_message;
+  PresenterErrorCode error_code = channel->SendMessage(req, recv_message);
+  if (error_code != PresenterErrorCode::kNone) {
+    AGENT_LOG_ERROR("Failed to present results, error = %d", error_code);
+    return error_code;
+  }
+
+  return PresenterMessageHelper::CheckPresentImageResponse(*recv_message,
+                                                           &viewer_count);
 }
 
 PresenterErrorCode SendMessage(
@@ -33,6 +33,9 @@
 
 #include "ascenddk/presenter/agent/presenter/presenter_message_helper.h"
 
+#include <string.h>
+#include <algorithm>
+
 #include "ascenddk/presenter/agent/util/logging.h"
 
 using std::string;
@@ -40,6 +43,99 @@ using std::string;
 namespace ascend {
 namespace presenter {
 
+namespace {
+
+// largest coordinate of the packed face data
+const uint32_t kMaxPackedCoordinate = 32767;
+
+/**
+ * @brief append a little-endian value to the packed face data
+ */
+void AppendUInt16(string& data, uint16_t value) {
+    data.push_back(static_cast<char>(value & 0xff));
+    data.push_back(static_cast<char>(value >> 8));
+}
+
+void AppendCoordinate(string& data, uint32_t value) {
+    AppendUInt16(data, static_cast<uint16_t>(
+            std::min(value, kMaxPackedCoordinate)));
+}
+
+void AppendFloat(string& data, float value) {
+    uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    AppendUInt16(data, static_cast<uint16_t>(bits & 0xffff));
+    AppendUInt16(data, static_cast<uint16_t>(bits >> 16));
+}
+
+/**
+ * @brief pack all faces into face_data, see presenter_message.proto for the
+ *        layout. It is about a third of the size of the same landmarks in
+ *        point_list
+ */
+void PackFaceResults(string& data, const std::vector<FaceResult>& faces) {
+    uint16_t landmark_num = faces.empty() ?
+            0 : static_cast<uint16_t>(faces[0].landmarks.size());
+    size_t face_size = 4 * 2 + 3 * 4 + landmark_num * 2 * 2;
+    data.clear();
+    data.reserve(2 * 2 + faces.size() * face_size);
+
+    AppendUInt16(data, static_cast<uint16_t>(faces.size()));
+    AppendUInt16(data, landmark_num);
+    for (const FaceResult &face : faces) {
+        AppendCoordinate(data, face.lt.x);
+        AppendCoordinate(data, face.lt.y);
+        AppendCoordinate(data, face.rb.x);
+        AppendCoordinate(data, face.rb.y);
+        for (float angle : face.pose) {
+            AppendFloat(data, angle);
+        }
+
+        // every face has landmark_num points, missing points are 0
+        for (uint16_t i = 0; i < landmark_num; ++i) {
+            Point point = { 0, 0 };
+            if (i < face.landmarks.size()) {
+                point = face.landmarks[i];
+            }
+            AppendCoordinate(data, point.x);
+            AppendCoordinate(data, point.y);
+        }
+    }
+}
+
+/**
+ * @brief set the rectangles and the landmark points of all results, the
+ *        packed faces and the liveness state, shared by PresentImageRequest
+ *        and PresentResultsRequest
+ */
+template<typename Request>
+void AddDetectionResults(Request& request, const ImageFrame& image) {
+    for (const DetectionResult &result : image.detection_results) {
+        proto::Rectangle_Attr *rectangle_attr = request.add_rectangle_list();
+        rectangle_attr->mutable_left_top()->set_x(result.lt.x);
+        rectangle_attr->mutable_left_top()->set_y(result.lt.y);
+        rectangle_attr->mutable_right_bottom()->set_x(result.rb.x);
+        rectangle_attr->mutable_right_bottom()->set_y(result.rb.y);
+        rectangle_attr->set_label_text(result.result_text);
+
+        // landmark points of all results, in the order of the results
+        for (const Point &point : result.points) {
+            proto::Coordinate *coordinate = request.add_point_list();
+            coordinate->set_x(point.x);
+            coordinate->set_y(point.y);
+        }
+    }
+
+    if (!image.face_results.empty()) {
+        PackFaceResults(*request.mutable_face_data(), image.face_results);
+    }
+
+    // LivenessState has the same values as proto::LivenessState
+    request.set_liveness(static_cast<proto::LivenessState>(image.liveness));
+}
+
+}  // namespace
+
 PresenterErrorCode PresenterMessageHelper::CreateOpenChannelRequest(
         proto::OpenChannelRequest& request, const string& channel_name,
         ContentType content_type) {
@@ -73,36 +169,27 @@ bool PresenterMessageHelper::InitPresentImageRequest(
         return false;
     }
 
-    // data can not be NULL
-    if (image.data == nullptr) {
+    // data can not be NULL, size 0 means results only
+    if (image.data == nullptr && image.size != 0) {
         AGENT_LOG_ERROR("Image data is NULL");
         return false;
     }
 
-    // size should greater than 0
-    if (image.size == 0) {
-        AGENT_LOG_ERROR("Image data size is 0");
-        return false;
-    }
-
     request.set_width(image.width);
     request.set_height(image.height);
 
-    // set the rectangle attr
-    proto::Rectangle_Attr *rectangle_attr = nullptr;
-    for (uint32_t i = 0; i < image.detection_results.size(); i++)
-    {
-	rectangle_attr = request.add_rectangle_list();
-	rectangle_attr->mutable_left_top()-> set_x(image.detection_results[i].lt.x);
-	rectangle_attr->mutable_left_top()-> set_y(image.detection_results[i].lt.y);
-	rectangle_attr->mutable_right_bottom()->set_x(image.detection_results[i].rb.x);
-        rectangle_attr->mutable_right_bottom()->set_y(image.detection_results[i].rb.y);
-	rectangle_attr->set_label_text(image.detection_results[i].result_text);
-    }
+    AddDetectionResults(request, image);
     // image.data may be too large to affect performance, so it is not set here
     return true;
 }
 
+void PresenterMessageHelper::InitPresentResultsRequest(
+        proto::PresentResultsRequest& request, const ImageFrame& image) {
+    request.set_width(image.width);
+    request.set_height(image.height);
+    AddDetectionResults(request, image);
+}
+
 PresenterErrorCode PresenterMessageHelper::TranslateErrorCode(
         proto::OpenChannelErrorCode error_code) {
     switch (error_code) {
@@ -150,7 +237,7 @@ PresenterErrorCode PresenterMessageHelper::TranslateErrorCode(
 }
 
 PresenterErrorCode PresenterMessageHelper::CheckPresentImageResponse(
-        const ::google::protobuf::Message& msg) {
+        const ::google::protobuf::Message& msg, uint32_t *viewer_count) {
     // check response
     string msg_name = msg.GetDescriptor()->full_name();
 
@@ -163,6 +250,9 @@ PresenterErrorCode PresenterMessageHelper::CheckPresentImageResponse(
 
     const proto::PresentImageResponse& resp =
             static_cast<const proto::PresentImageResponse&>(msg);
+    if (viewer_count != nullptr) {
+        *viewer_count = resp.viewer_count();
+    }
     return TranslateErrorCode(resp.error_code());
 }
 
@@ -65,7 +65,8 @@ class PresenterMessageHelper {
       ContentType content_type);
 
   /**
-   * @brief create PresentImageRequest
+   * @brief create PresentImageRequest, rectangles and landmark points are
+   *        set, the image data is not set, it is sent as a TLV
    * @param [out] request         request to set the properties
    * @param [in] image            image
    * @return true: success, false: failure
@@ -73,6 +74,15 @@ class PresenterMessageHelper {
   static bool InitPresentImageRequest(proto::PresentImageRequest& request,
                                       const ImageFrame& image);
 
+  /**
+   * @brief create PresentResultsRequest from the size and the results of
+   *        the image, the image data is ignored
+   * @param [out] request         request to set the properties
+   * @param [in] image            image
+   */
+  static void InitPresentResultsRequest(proto::PresentResultsRequest& request,
+                                        const ImageFrame& image);
+
   /**
    * @brief Check OpenChannelResponse
    * @param [in] msg              Open Channel Response
@@ -84,10 +94,13 @@ class PresenterMessageHelper {
   /**
    * @brief Check PresentImageResponse
    * @param [in] msg              Present Image Response
+   * @param [out] viewer_count    browsers watching the channel, not set when
+   *                              NULL or the response is not expected
    * @return PresenterErrorCode
    */
   static PresenterErrorCode CheckPresentImageResponse(
-      const ::google::protobuf::Message& msg);
+      const ::google::protobuf::Message& msg,
+      uint32_t *viewer_count = nullptr);
 
  private:
   /**